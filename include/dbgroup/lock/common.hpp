@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <thread>
 
@@ -34,6 +35,23 @@
 
 namespace dbgroup::lock
 {
+/*##############################################################################
+ * Global enums
+ *############################################################################*/
+
+/**
+ * @brief Lock modes for acquiring multiple locks at once.
+ *
+ */
+enum class LockMode : uint32_t {
+  /// @brief A shared lock.
+  kS,
+  /// @brief A shared-with-intent-exclusive lock.
+  kSIX,
+  /// @brief An exclusive lock.
+  kX,
+};
+
 /*##############################################################################
  * Global constants
  *############################################################################*/
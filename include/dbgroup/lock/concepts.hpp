@@ -0,0 +1,109 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_CONCEPTS_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_CONCEPTS_HPP_
+
+// C++ standard libraries
+#include <concepts>
+#include <type_traits>
+
+namespace dbgroup::lock
+{
+/*##############################################################################
+ * Lock guards
+ *############################################################################*/
+
+/**
+ * @brief A concept of guards that own locks until destruction.
+ *
+ * An empty guard (i.e., `false` by the bool conversion) does not own any lock.
+ */
+template <class Guard>
+concept LockGuard = std::default_initializable<Guard>                 //
+                    && std::is_nothrow_move_constructible_v<Guard>  //
+                    && std::is_move_assignable_v<Guard>             //
+                    && std::constructible_from<bool, const Guard &>;
+
+/**
+ * @brief A concept of guards that retain versions for optimistic reads.
+ *
+ */
+template <class Guard>
+concept VersionGuard = std::copyable<Guard>  //
+                       && requires(Guard &guard) {
+                            { guard.GetVersion() } -> std::unsigned_integral;
+                            { guard.VerifyVersion() } -> std::same_as<bool>;
+                          };
+
+/*##############################################################################
+ * Locks
+ *############################################################################*/
+
+/**
+ * @brief A concept of locks supporting exclusive (X) locks.
+ *
+ */
+template <class Lock>
+concept ExclusiveLockable = requires(Lock &lock) {
+  { lock.LockX() } -> LockGuard;
+};
+
+/**
+ * @brief A concept of locks supporting shared (S) and X locks.
+ *
+ */
+template <class Lock>
+concept SharedLockable = ExclusiveLockable<Lock> && requires(Lock &lock) {
+  { lock.LockS() } -> LockGuard;
+};
+
+/**
+ * @brief A concept of locks supporting S, shared-with-intent-exclusive (SIX),
+ * and X locks.
+ *
+ */
+template <class Lock>
+concept SIXLockable = SharedLockable<Lock> && requires(Lock &lock) {
+  { lock.LockSIX() } -> LockGuard;
+  { lock.LockSIX().UpgradeToX() } -> LockGuard;
+};
+
+/**
+ * @brief A concept of locks supporting version-based optimistic reads.
+ *
+ */
+template <class Lock>
+concept OptimisticLockable = ExclusiveLockable<Lock> && requires(Lock &lock) {
+  { lock.GetVersion() } -> VersionGuard;
+};
+
+/**
+ * @brief A concept of optimistic locks whose versions can be upgraded into
+ * S/SIX/X locks with version verification.
+ *
+ */
+template <class Lock>
+concept UpgradableOptimisticLockable =
+    OptimisticLockable<Lock> && requires(typename Lock::OptGuard guard) {
+      { guard.TryLockS() } -> LockGuard;
+      { guard.TryLockSIX() } -> LockGuard;
+      { guard.TryLockX() } -> LockGuard;
+    };
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_CONCEPTS_HPP_
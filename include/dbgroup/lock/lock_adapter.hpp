@@ -0,0 +1,154 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_LOCK_ADAPTER_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_LOCK_ADAPTER_HPP_
+
+// local sources
+#include "dbgroup/lock/concepts.hpp"
+
+namespace dbgroup::lock
+{
+/*##############################################################################
+ * Global utilities
+ *############################################################################*/
+
+/**
+ * @brief Get an exclusive lock.
+ *
+ * @param lock A target lock.
+ * @return A guard instance for the acquired lock.
+ */
+template <ExclusiveLockable Lock>
+[[nodiscard]] auto
+AcquireX(  //
+    Lock &lock)
+{
+  return lock.LockX();
+}
+
+/**
+ * @brief Get a shared-with-intent-exclusive lock or the strongest substitute.
+ *
+ * @param lock A target lock.
+ * @return A guard instance for an SIX lock if supported or an X lock otherwise.
+ */
+template <ExclusiveLockable Lock>
+[[nodiscard]] auto
+AcquireSIX(  //
+    Lock &lock)
+{
+  if constexpr (SIXLockable<Lock>) {
+    return lock.LockSIX();
+  } else {
+    return lock.LockX();
+  }
+}
+
+/**
+ * @brief Get a shared lock or the strongest substitute.
+ *
+ * @param lock A target lock.
+ * @return A guard instance for an S lock if supported or an X lock otherwise.
+ */
+template <ExclusiveLockable Lock>
+[[nodiscard]] auto
+AcquireS(  //
+    Lock &lock)
+{
+  if constexpr (SharedLockable<Lock>) {
+    return lock.LockS();
+  } else {
+    return lock.LockX();
+  }
+}
+
+/**
+ * @brief A class for providing S/SIX/X locks of any lock class.
+ *
+ * This class inherits a given lock class and fills missing lock modes with X
+ * locks (e.g., `LockS` of `LockAdapter<OptiQL>` acquires an X lock). Thus,
+ * data structures templated over this class can be instantiated with each
+ * lock class without code forks. This class does not add any member
+ * variables, so it has the same size as a given lock class.
+ *
+ * @tparam Lock A class of locks.
+ */
+template <ExclusiveLockable Lock>
+class LockAdapter : public Lock
+{
+ public:
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief A flag for indicating the original lock supports S locks.
+  static constexpr bool kHasSLock = SharedLockable<Lock>;
+
+  /// @brief A flag for indicating the original lock supports SIX locks.
+  static constexpr bool kHasSIXLock = SIXLockable<Lock>;
+
+  /// @brief A flag for indicating the original lock supports optimistic reads.
+  static constexpr bool kIsOptimistic = OptimisticLockable<Lock>;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr LockAdapter() = default;
+
+  LockAdapter(const LockAdapter &) = delete;
+  LockAdapter(LockAdapter &&) = delete;
+
+  auto operator=(const LockAdapter &) -> LockAdapter & = delete;
+  auto operator=(LockAdapter &&) -> LockAdapter & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~LockAdapter() = default;
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Get a shared lock or the strongest substitute.
+   *
+   * @return A guard instance for the acquired lock.
+   */
+  [[nodiscard]] auto
+  LockS()
+  {
+    return AcquireS(static_cast<Lock &>(*this));
+  }
+
+  /**
+   * @brief Get a shared-with-intent-exclusive lock or the strongest substitute.
+   *
+   * @return A guard instance for the acquired lock.
+   */
+  [[nodiscard]] auto
+  LockSIX()
+  {
+    return AcquireSIX(static_cast<Lock &>(*this));
+  }
+};
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_LOCK_ADAPTER_HPP_
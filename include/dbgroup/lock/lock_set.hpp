@@ -0,0 +1,422 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_LOCK_SET_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_LOCK_SET_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+#include "dbgroup/lock/concepts.hpp"
+#include "dbgroup/lock/lock_adapter.hpp"
+
+namespace dbgroup::lock
+{
+/**
+ * @brief A class for acquiring multiple locks without deadlocks.
+ *
+ * This class sorts registered locks by their addresses and acquires them in
+ * that order, so threads using this class never wait for each other in a
+ * cycle. Optimistic guards are upgraded by their `TryLock` functions, and if
+ * any version verification fails, this class releases all the acquired locks
+ * (i.e., all or nothing). This class accepts locks of different classes (e.g.,
+ * `PessimisticLock`, `OptimisticLock`, `MCSLock`, and `OptiQL`) and does not
+ * allocate heap memory for `kInlineNum` or fewer locks.
+ *
+ * @tparam kInlineNum The maximum number of locks without heap allocation.
+ */
+template <size_t kInlineNum = 8>
+class LockSet
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr LockSet() = default;
+
+  LockSet(const LockSet &) = delete;
+  LockSet(LockSet &&) = delete;
+
+  auto operator=(const LockSet &) -> LockSet & = delete;
+  auto operator=(LockSet &&) -> LockSet & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Destroy this instance and release all the locks if holding.
+   *
+   */
+  ~LockSet() { Release(); }
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The number of registered locks.
+   */
+  [[nodiscard]] constexpr auto
+  GetSize() const  //
+      -> size_t
+  {
+    return size_;
+  }
+
+  /**
+   * @retval true if this instance holds all the registered locks.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] constexpr auto
+  HasLocks() const  //
+      -> bool
+  {
+    return has_locks_;
+  }
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Register a lock for pessimistic acquisition.
+   *
+   * If a lock class does not support a given mode (e.g., S locks of `OptiQL`),
+   * this instance acquires a stronger lock instead.
+   *
+   * @tparam Lock A class of locks.
+   * @param lock A target lock.
+   * @param mode A desired lock mode.
+   * @note Registering locks after `Acquire` is not allowed until `Release`.
+   */
+  template <ExclusiveLockable Lock>
+  void
+  Add(  //
+      Lock &lock,
+      const LockMode mode)
+  {
+    Push(Entry{&lock, &AcquirePessimistic<Lock>, mode, 0, false});
+  }
+
+  /**
+   * @brief Register an optimistic guard to be upgraded.
+   *
+   * @tparam Lock A class of locks supporting `TryLock` functions.
+   * @param lock A target lock.
+   * @param guard An optimistic guard created by the target lock.
+   * @param mode A desired lock mode.
+   * @note Registering locks after `Acquire` is not allowed until `Release`.
+   */
+  template <UpgradableOptimisticLockable Lock>
+  void
+  Add(  //
+      Lock &lock,
+      const typename Lock::OptGuard &guard,
+      const LockMode mode)
+  {
+    Push(Entry{&lock, &AcquireOptimistic<Lock>, mode, guard.GetVersion(), true});
+  }
+
+  /**
+   * @brief Acquire all the registered locks in address order.
+   *
+   * Pessimistic locks are acquired with spinlock and back-off, and optimistic
+   * guards are upgraded with version verification. If any verification fails,
+   * this function releases the acquired locks without modifying their versions
+   * and clears registered ones.
+   *
+   * @retval true if this instance acquires all the registered locks.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto
+  Acquire()  //
+      -> bool
+  {
+    auto &&entries = GetEntries();
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry &a, const Entry &b) { return std::less<>{}(a.lock, b.lock); });
+    if (!MergeDuplicates()) {
+      Clear();
+      return false;
+    }
+
+    for (size_t i = 0; i < size_; ++i) {
+      if (entries[i].acquire(&entries[i])) continue;
+
+      while (i-- > 0) {
+        entries[i].release(&entries[i], true);
+      }
+      Clear();
+      return false;
+    }
+
+    has_locks_ = true;
+    return true;
+  }
+
+  /**
+   * @brief Release all the acquired locks and clear registered ones.
+   *
+   */
+  void
+  Release()
+  {
+    if (has_locks_) {
+      auto &&entries = GetEntries();
+      for (size_t i = size_; i > 0; --i) {
+        entries[i - 1].release(&entries[i - 1], false);
+      }
+      has_locks_ = false;
+    }
+    Clear();
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The maximum size of lock guards.
+  static constexpr size_t kGuardSize = 3 * kWordSize;
+
+  /*############################################################################
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief A type-erased lock and its guard.
+   *
+   */
+  struct Entry {
+    /// @brief The address of a target lock.
+    void *lock{};
+
+    /// @brief A function for acquiring a lock.
+    bool (*acquire)(Entry *){};
+
+    /// @brief A desired lock mode.
+    LockMode mode{};
+
+    /// @brief A version for optimistic guards.
+    uint32_t ver{};
+
+    /// @brief A flag for indicating this entry upgrades an optimistic guard.
+    bool is_optimistic{};
+
+    /// @brief A function for releasing an acquired lock.
+    void (*release)(Entry *, bool){};
+
+    /// @brief A buffer for an acquired lock guard.
+    alignas(kWordSize) std::array<std::byte, kGuardSize> guard{};
+  };
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @return The registered locks.
+   */
+  [[nodiscard]] auto
+  GetEntries()  //
+      -> std::span<Entry>
+  {
+    if (overflow_.empty()) return {inline_.data(), size_};
+    return {overflow_.data(), size_};
+  }
+
+  /**
+   * @param entry A lock to be registered.
+   */
+  void
+  Push(  //
+      Entry &&entry)
+  {
+    if (size_ < kInlineNum) {
+      inline_[size_++] = std::move(entry);
+      return;
+    }
+    if (size_ == kInlineNum) {
+      overflow_.reserve(2 * kInlineNum);
+      overflow_.assign(inline_.begin(), inline_.end());
+    }
+    overflow_.emplace_back(std::move(entry));
+    ++size_;
+  }
+
+  /**
+   * @brief Clear registered locks with retaining the heap buffer.
+   *
+   */
+  void
+  Clear()
+  {
+    overflow_.clear();
+    size_ = 0;
+  }
+
+  /**
+   * @brief Merge duplicate locks into one with the strongest mode.
+   *
+   * @retval true if duplicate optimistic guards have the same version.
+   * @retval false otherwise.
+   */
+  auto
+  MergeDuplicates()  //
+      -> bool
+  {
+    auto &&entries = GetEntries();
+    size_t n = 0;
+    for (size_t i = 0; i < size_; ++i) {
+      if (n == 0 || entries[n - 1].lock != entries[i].lock) {
+        entries[n++] = entries[i];
+        continue;
+      }
+
+      auto &dup = entries[n - 1];
+      dup.mode = std::max(dup.mode, entries[i].mode);
+      if (!entries[i].is_optimistic) continue;
+      if (dup.is_optimistic && dup.ver != entries[i].ver) return false;
+      dup.acquire = entries[i].acquire;
+      dup.ver = entries[i].ver;
+      dup.is_optimistic = true;
+    }
+
+    if (!overflow_.empty()) {
+      overflow_.resize(n);
+    }
+    size_ = n;
+    return true;
+  }
+
+  /**
+   * @brief Move an acquired guard into a given entry.
+   *
+   * @tparam Guard A class of lock guards.
+   * @param entry A target entry.
+   * @param guard An acquired lock guard.
+   */
+  template <class Guard>
+  static void
+  Store(  //
+      Entry *entry,
+      Guard &&guard)
+  {
+    static_assert(sizeof(Guard) <= kGuardSize && alignof(Guard) <= kWordSize);
+
+    std::construct_at(reinterpret_cast<Guard *>(entry->guard.data()), std::move(guard));
+    entry->release = [](Entry *entry, const bool abort) {
+      auto *guard = std::launder(reinterpret_cast<Guard *>(entry->guard.data()));
+      if constexpr (requires { guard->SetVersion(guard->GetVersion()); }) {
+        // aborted X locks do not modify anything, so keep their versions
+        if (abort) guard->SetVersion(guard->GetVersion());
+      }
+      std::destroy_at(guard);
+    };
+  }
+
+  /**
+   * @tparam Lock A class of locks.
+   * @param entry A target entry.
+   * @retval true always.
+   */
+  template <class Lock>
+  static auto
+  AcquirePessimistic(  //
+      Entry *entry)    //
+      -> bool
+  {
+    auto &lock = *static_cast<Lock *>(entry->lock);
+    switch (entry->mode) {
+      case LockMode::kS:
+        Store(entry, AcquireS(lock));
+        break;
+      case LockMode::kSIX:
+        Store(entry, AcquireSIX(lock));
+        break;
+      case LockMode::kX:
+      default:
+        Store(entry, AcquireX(lock));
+    }
+    return true;
+  }
+
+  /**
+   * @tparam Lock A class of locks.
+   * @param entry A target entry.
+   * @retval true if a version is verified and a lock is acquired.
+   * @retval false otherwise.
+   */
+  template <class Lock>
+  static auto
+  AcquireOptimistic(  //
+      Entry *entry)   //
+      -> bool
+  {
+    using OptGuard = typename Lock::OptGuard;
+    using Version = decltype(OptGuard{}.GetVersion());
+
+    OptGuard opt_guard{static_cast<Lock *>(entry->lock), static_cast<Version>(entry->ver)};
+    auto &&try_lock = [entry](auto &&guard) -> bool {
+      if (!guard) return false;
+      Store(entry, std::move(guard));
+      return true;
+    };
+
+    switch (entry->mode) {
+      case LockMode::kS:
+        return try_lock(opt_guard.TryLockS());
+      case LockMode::kSIX:
+        return try_lock(opt_guard.TryLockSIX());
+      case LockMode::kX:
+      default:
+        return try_lock(opt_guard.TryLockX());
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of registered locks.
+  size_t size_{0};
+
+  /// @brief A flag for indicating this instance holds locks.
+  bool has_locks_{false};
+
+  /// @brief Registered locks without heap allocation.
+  std::array<Entry, kInlineNum> inline_{};
+
+  /// @brief Registered locks exceeding the inline capacity.
+  std::vector<Entry> overflow_{};
+};
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_LOCK_SET_HPP_
@@ -0,0 +1,338 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_LOCK_TABLE_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_LOCK_TABLE_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+#include "dbgroup/lock/concepts.hpp"
+#include "dbgroup/lock/lock_adapter.hpp"
+#include "dbgroup/lock/lock_set.hpp"
+#include "dbgroup/lock/pessimistic_lock.hpp"
+
+namespace dbgroup::lock
+{
+/**
+ * @brief A class for locking 64-bit keys with a fixed number of locks.
+ *
+ * This class hashes each key onto an array of cache-line-padded locks (i.e.,
+ * stripes), so locking keys does not need any memory per key. If a split
+ * threshold is given, each stripe counts acquisitions that waited for other
+ * threads, and `SplitHotStripes` divides contended stripes into
+ * `kSplitNum` sub-stripes. If a lock class does not support a requested mode
+ * (e.g., S locks of `OptiQL`), this class acquires a stronger lock instead.
+ *
+ * @tparam Lock A class of locks (e.g., `PessimisticLock`, `OptimisticLock`, and
+ * `MCSLock`).
+ */
+template <ExclusiveLockable Lock = PessimisticLock>
+class LockTable
+{
+ public:
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The default number of stripes per thread.
+  static constexpr size_t kDefaultStripesPerThread = 256;
+
+  /// @brief The number of sub-stripes for each split stripe.
+  static constexpr size_t kSplitNum = 8;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param thread_num The expected number of concurrent threads.
+   * @param split_threshold The number of contended acquisitions for splitting
+   * a stripe (zero disables contention measurement).
+   * @param stripes_per_thread The number of stripes per thread.
+   */
+  explicit LockTable(  //
+      const size_t thread_num = std::thread::hardware_concurrency(),
+      const size_t split_threshold = 0,
+      const size_t stripes_per_thread = kDefaultStripesPerThread)
+      : stripe_num_{std::bit_ceil(std::max<size_t>(thread_num * stripes_per_thread, 2))},
+        shift_{static_cast<size_t>(kBitNum - std::countr_zero(stripe_num_))},
+        split_threshold_{split_threshold},
+        stripes_{std::make_unique<Stripe[]>(stripe_num_)}
+  {
+  }
+
+  LockTable(const LockTable &) = delete;
+  LockTable(LockTable &&) = delete;
+
+  auto operator=(const LockTable &) -> LockTable & = delete;
+  auto operator=(LockTable &&) -> LockTable & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Destroy this instance and its sub-stripes.
+   *
+   */
+  ~LockTable()
+  {
+    for (size_t i = 0; i < stripe_num_; ++i) {
+      delete[] stripes_[i].sub.load(kRelaxed);
+    }
+  }
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The number of stripes (excluding sub-stripes).
+   */
+  [[nodiscard]] constexpr auto
+  GetStripeNum() const  //
+      -> size_t
+  {
+    return stripe_num_;
+  }
+
+  /**
+   * @return The number of split stripes.
+   */
+  [[nodiscard]] auto
+  GetSplitNum() const  //
+      -> size_t
+  {
+    return split_num_;
+  }
+
+  /**
+   * @param key A target key.
+   * @return The lock currently protecting a given key.
+   */
+  [[nodiscard]] auto
+  GetLock(                       //
+      const uint64_t key) const  //
+      -> Lock &
+  {
+    const auto hash = Hash(key);
+    auto &stripe = stripes_[hash >> shift_];
+    auto *sub = stripe.sub.load(kRelaxed);
+    return sub ? sub[hash & (kSplitNum - 1)].lock : stripe.lock;
+  }
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @return A guard instance for the acquired shared lock.
+   */
+  [[nodiscard]] auto
+  LockS(  //
+      const uint64_t key)
+  {
+    return Measure(key, [](Lock &lock) { return AcquireS(lock); });
+  }
+
+  /**
+   * @param key A target key.
+   * @return A guard instance for the acquired shared-with-intent-exclusive lock.
+   */
+  [[nodiscard]] auto
+  LockSIX(  //
+      const uint64_t key)
+  {
+    return Measure(key, [](Lock &lock) { return AcquireSIX(lock); });
+  }
+
+  /**
+   * @param key A target key.
+   * @return A guard instance for the acquired exclusive lock.
+   */
+  [[nodiscard]] auto
+  LockX(  //
+      const uint64_t key)
+  {
+    return Measure(key, [](Lock &lock) { return AcquireX(lock); });
+  }
+
+  /**
+   * @brief Lock a sorted set of keys at once.
+   *
+   * This function registers the locks of given keys into a lock set, which
+   * merges keys sharing the same lock and acquires locks in address order.
+   * Callers release all the locks by `LockSet::Release`.
+   *
+   * @param keys Sorted target keys.
+   * @param mode A desired lock mode.
+   * @param lock_set An empty lock set to retain acquired locks.
+   * @retval true if all the locks are acquired.
+   * @retval false otherwise.
+   */
+  template <size_t kInlineNum>
+  [[nodiscard]] auto
+  LockBatch(  //
+      const std::span<const uint64_t> keys,
+      const LockMode mode,
+      LockSet<kInlineNum> &lock_set)  //
+      -> bool
+  {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      if (i > 0 && keys[i] == keys[i - 1]) continue;
+      lock_set.Add(GetLock(keys[i]), mode);
+    }
+    return lock_set.Acquire();
+  }
+
+  /**
+   * @brief Split stripes that have exceeded the split threshold.
+   *
+   * @return The number of stripes split by this call.
+   * @note This function must be called when no thread holds or acquires any
+   * lock in this table (e.g., between benchmark phases) because it changes
+   * the mapping from keys to locks.
+   */
+  auto
+  SplitHotStripes()  //
+      -> size_t
+  {
+    if (split_threshold_ == 0) return 0;
+
+    size_t split_num = 0;
+    for (size_t i = 0; i < stripe_num_; ++i) {
+      auto &stripe = stripes_[i];
+      if (stripe.sub.load(kRelaxed) != nullptr) continue;
+      if (stripe.conflict_num.load(kRelaxed) < split_threshold_) continue;
+      stripe.sub.store(new Stripe[kSplitNum], kRelaxed);
+      ++split_num;
+    }
+
+    split_num_ += split_num;
+    return split_num;
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of bits in one word.
+  static constexpr size_t kBitNum = 64;
+
+  /*############################################################################
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief A lock padded by a cache line.
+   *
+   */
+  struct alignas(kCacheLineSize) Stripe {
+    /// @brief A lock for keys hashed onto this stripe.
+    Lock lock{};
+
+    /// @brief The number of acquisitions waiting for other threads.
+    std::atomic_size_t conflict_num{0};
+
+    /// @brief Sub-stripes if this stripe has been split.
+    std::atomic<Stripe *> sub{nullptr};
+  };
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param key A target key.
+   * @return A hash value of the key (murmur3's finalizer).
+   */
+  [[nodiscard]] static constexpr auto
+  Hash(  //
+      uint64_t key)  //
+      -> uint64_t
+  {
+    key ^= key >> 33UL;
+    key *= 0xFF51AFD7ED558CCDUL;
+    key ^= key >> 33UL;
+    key *= 0xC4CEB9FE1A85EC53UL;
+    key ^= key >> 33UL;
+    return key;
+  }
+
+  /**
+   * @brief Acquire a lock with measuring its contention if needed.
+   *
+   * @param key A target key.
+   * @param lock_fn A function for acquiring a lock.
+   * @return A guard instance for the acquired lock.
+   */
+  template <class Func>
+  [[nodiscard]] auto
+  Measure(  //
+      const uint64_t key,
+      Func &&lock_fn)
+  {
+    const auto hash = Hash(key);
+    auto &stripe = stripes_[hash >> shift_];
+    auto *sub = stripe.sub.load(kRelaxed);
+    if (sub) return lock_fn(sub[hash & (kSplitNum - 1)].lock);
+    if (split_threshold_ == 0) return lock_fn(stripe.lock);
+
+    // acquiring an uncontended lock never waits for a back-off interval
+    const auto begin = std::chrono::steady_clock::now();
+    auto &&guard = lock_fn(stripe.lock);
+    if (std::chrono::steady_clock::now() - begin >= kBackOffTime) {
+      stripe.conflict_num.fetch_add(1, kRelaxed);
+    }
+    return guard;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The number of stripes.
+  size_t stripe_num_{};
+
+  /// @brief A bit shift for extracting stripe IDs from hash values.
+  size_t shift_{};
+
+  /// @brief The number of contended acquisitions for splitting a stripe.
+  size_t split_threshold_{};
+
+  /// @brief The number of split stripes.
+  size_t split_num_{0};
+
+  /// @brief An array of stripes.
+  std::unique_ptr<Stripe[]> stripes_{};
+};
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_LOCK_TABLE_HPP_
@@ -19,21 +19,41 @@
 
 // C++ standard libraries
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
 
 namespace dbgroup::lock
 {
 /**
  * @brief A class for representing simple optimistic locks.
  *
+ * A lock word contains an X lock flag, an SIX lock flag, and a shared lock
+ * counter in its upper half and a version value in its lower half. Smaller
+ * words are suitable for headers of nodes and slots, but their versions wrap
+ * around after 2^16 (32-bit) or 2^8 (16-bit) modifications and the number of
+ * concurrent shared locks is limited to 2^14 - 1 (32-bit) or 2^6 - 1 (16-bit).
+ *
+ * @tparam Word An unsigned integer type for lock states (`uint64_t`,
+ * `uint32_t`, or `uint16_t`).
  */
-class OptimisticLock
+template <class Word>
+class BasicOptimisticLock
 {
  public:
   /*############################################################################
    * Public types
    *##########################################################################*/
 
+  /// @brief An unsigned integer type for versions (the lower half of words).
+  using Version = std::conditional_t<
+      sizeof(Word) == 8,
+      uint32_t,
+      std::conditional_t<sizeof(Word) == 4, uint16_t, uint8_t>>;
+
   // forward declarations
   class XGuard;
 
@@ -54,7 +74,7 @@ class OptimisticLock
      * @param dest The address of a target lock.
      */
     constexpr explicit SGuard(  //
-        OptimisticLock *dest)
+        BasicOptimisticLock *dest)
         : dest_{dest}
     {
     }
@@ -104,7 +124,7 @@ class OptimisticLock
      *########################################################################*/
 
     /// @brief The address of a target lock.
-    OptimisticLock *dest_{};
+    BasicOptimisticLock *dest_{};
   };
 
   /**
@@ -124,7 +144,7 @@ class OptimisticLock
      * @param dest The address of a target lock.
      */
     constexpr explicit SIXGuard(  //
-        OptimisticLock *dest)
+        BasicOptimisticLock *dest)
         : dest_{dest}
     {
     }
@@ -184,7 +204,7 @@ class OptimisticLock
      *########################################################################*/
 
     /// @brief The address of a target lock.
-    OptimisticLock *dest_{};
+    BasicOptimisticLock *dest_{};
   };
 
   /**
@@ -205,9 +225,9 @@ class OptimisticLock
      * @param ver The current version.
      */
     constexpr XGuard(  //
-        OptimisticLock *dest,
-        const uint32_t ver)
-        : dest_{dest}, old_ver_{ver}, new_ver_{ver + 1U}
+        BasicOptimisticLock *dest,
+        const Version ver)
+        : dest_{dest}, old_ver_{ver}, new_ver_{static_cast<Version>(ver + 1U)}
     {
     }
 
@@ -255,7 +275,7 @@ class OptimisticLock
      */
     [[nodiscard]] constexpr auto
     GetVersion() const  //
-        -> uint32_t
+        -> Version
     {
       return old_ver_;
     }
@@ -267,7 +287,7 @@ class OptimisticLock
      */
     constexpr void
     SetVersion(  //
-        const uint32_t ver)
+        const Version ver)
     {
       new_ver_ = ver;
     }
@@ -288,13 +308,13 @@ class OptimisticLock
      *########################################################################*/
 
     /// @brief The address of a target lock.
-    OptimisticLock *dest_{};
+    BasicOptimisticLock *dest_{};
 
     /// @brief A version when creating this guard.
-    uint32_t old_ver_{};
+    Version old_ver_{};
 
     /// @brief A version when failing verification.
-    uint32_t new_ver_{};
+    Version new_ver_{};
   };
 
   /**
@@ -315,8 +335,8 @@ class OptimisticLock
      * @param ver The current version.
      */
     constexpr OptGuard(  //
-        OptimisticLock *dest,
-        const uint32_t ver)
+        BasicOptimisticLock *dest,
+        const Version ver)
         : dest_{dest}, ver_{ver}
     {
     }
@@ -351,7 +371,7 @@ class OptimisticLock
      */
     [[nodiscard]] constexpr auto
     GetVersion() const  //
-        -> uint32_t
+        -> Version
     {
       return ver_;
     }
@@ -397,15 +417,30 @@ class OptimisticLock
         -> XGuard;
 
    private:
+    /*##########################################################################
+     * Internal APIs
+     *########################################################################*/
+
+    /**
+     * @brief Wait for an X lock to be released and verify a version value.
+     *
+     * @retval true if a target version does not change from an expected one.
+     * @retval false otherwise.
+     * @note This function is the slow path of `VerifyVersion` and is not
+     * inlined.
+     */
+    [[nodiscard]] auto VerifyVersionWithSpin()  //
+        -> bool;
+
     /*##########################################################################
      * Internal member variables
      *########################################################################*/
 
     /// @brief The address of a target lock.
-    OptimisticLock *dest_{};
+    BasicOptimisticLock *dest_{};
 
     /// @brief A version when creating this guard.
-    uint32_t ver_{};
+    Version ver_{};
   };
 
   /**
@@ -425,7 +460,7 @@ class OptimisticLock
      * @param dest The address of a target lock.
      */
     constexpr explicit CompositeGuard(  //
-        OptimisticLock *dest)
+        BasicOptimisticLock *dest)
         : dest_{dest}, has_lock_{true}
     {
     }
@@ -435,8 +470,8 @@ class OptimisticLock
      * @param ver The current version.
      */
     constexpr CompositeGuard(  //
-        OptimisticLock *dest,
-        const uint32_t ver)
+        BasicOptimisticLock *dest,
+        const Version ver)
         : dest_{dest}, ver_{ver}
     {
     }
@@ -485,7 +520,7 @@ class OptimisticLock
      */
     [[nodiscard]] constexpr auto
     GetVersion() const  //
-        -> uint32_t
+        -> Version
     {
       return ver_;
     }
@@ -507,10 +542,10 @@ class OptimisticLock
      *########################################################################*/
 
     /// @brief The address of a target lock.
-    OptimisticLock *dest_{};
+    BasicOptimisticLock *dest_{};
 
     /// @brief A version when creating this guard.
-    uint32_t ver_{};
+    Version ver_{};
 
     /// @brief A flag indicating whether this instance is holding a lock.
     bool has_lock_{};
@@ -520,19 +555,19 @@ class OptimisticLock
    * Public constructors and assignment operators
    *##########################################################################*/
 
-  constexpr OptimisticLock() = default;
+  constexpr BasicOptimisticLock() = default;
 
-  OptimisticLock(const OptimisticLock &) = delete;
-  OptimisticLock(OptimisticLock &&) = delete;
+  BasicOptimisticLock(const BasicOptimisticLock &) = delete;
+  BasicOptimisticLock(BasicOptimisticLock &&) = delete;
 
-  auto operator=(const OptimisticLock &) -> OptimisticLock & = delete;
-  auto operator=(OptimisticLock &&) -> OptimisticLock & = delete;
+  auto operator=(const BasicOptimisticLock &) -> BasicOptimisticLock & = delete;
+  auto operator=(BasicOptimisticLock &&) -> BasicOptimisticLock & = delete;
 
   /*############################################################################
    * Public destructors
    *##########################################################################*/
 
-  ~OptimisticLock() = default;
+  ~BasicOptimisticLock() = default;
 
   /*############################################################################
    * Optimistic lock APIs
@@ -544,8 +579,14 @@ class OptimisticLock
    * @note This function does not give up reading a version value and continues
    * with spinlock and back-off.
    */
-  [[nodiscard]] auto GetVersion()  //
-      -> OptGuard;
+  [[nodiscard]] auto
+  GetVersion()  //
+      -> OptGuard
+  {
+    const auto cur = lock_.load(kAcquire);
+    if ((cur & kXLock) == kNoLocks) return OptGuard{this, static_cast<Version>(cur)};
+    return GetVersionWithSpin();
+  }
 
   /**
    * @brief Prepare a guard instance to read contents.
@@ -567,10 +608,20 @@ class OptimisticLock
    *
    * @return A guard instance for the acquired lock.
    * @note This function does not give up acquiring a lock and continues with
-   * spinlock and back-off.
+   * spinlock and back-off. If the shared lock counter is full, this function
+   * also waits for another thread to release its shared lock.
    */
-  [[nodiscard]] auto LockS()  //
-      -> SGuard;
+  [[nodiscard]] auto
+  LockS()  //
+      -> SGuard
+  {
+    auto cur = lock_.load(kRelaxed);
+    if ((cur & kXLock) == kNoLocks && (cur & kSMask) != kSMask
+        && lock_.compare_exchange_weak(cur, cur + kSLock, kAcquire, kRelaxed)) {
+      return SGuard{this};
+    }
+    return LockSWithSpin();
+  }
 
   /**
    * @brief Get a shared-with-intent-exclusive lock.
@@ -579,8 +630,17 @@ class OptimisticLock
    * @note This function does not give up acquiring a lock and continues with
    * spinlock and back-off.
    */
-  [[nodiscard]] auto LockSIX()  //
-      -> SIXGuard;
+  [[nodiscard]] auto
+  LockSIX()  //
+      -> SIXGuard
+  {
+    auto cur = lock_.load(kRelaxed);
+    if ((cur & kXMask) == kNoLocks
+        && lock_.compare_exchange_weak(cur, cur | kSIXLock, kAcquire, kRelaxed)) {
+      return SIXGuard{this};
+    }
+    return LockSIXWithSpin();
+  }
 
   /**
    * @brief Get an exclusive lock.
@@ -589,21 +649,104 @@ class OptimisticLock
    * @note This function does not give up acquiring a lock and continues with
    * spinlock and back-off.
    */
-  [[nodiscard]] auto LockX()  //
-      -> XGuard;
+  [[nodiscard]] auto
+  LockX()  //
+      -> XGuard
+  {
+    auto cur = lock_.load(kRelaxed);
+    if ((cur & kAllLockMask) == kNoLocks
+        && lock_.compare_exchange_weak(cur, cur | kXLock, kAcquire, kRelaxed)) {
+      return XGuard{this, static_cast<Version>(cur)};
+    }
+    return LockXWithSpin();
+  }
 
  private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of bits in a lock word.
+  static constexpr size_t kBitNum = sizeof(Word) * 8;
+
+  /// @brief A lock state representing no locks.
+  static constexpr Word kNoLocks = 0;
+
+  /// @brief A lock state representing a shared lock.
+  static constexpr Word kSLock = static_cast<Word>(Word{1} << (kBitNum / 2));
+
+  /// @brief A lock state representing a shared-with-intent-exclusive lock.
+  static constexpr Word kSIXLock = static_cast<Word>(Word{1} << (kBitNum - 2));
+
+  /// @brief A lock state representing an exclusive lock.
+  static constexpr Word kXLock = static_cast<Word>(Word{1} << (kBitNum - 1));
+
+  /// @brief A bit mask for extracting version values.
+  static constexpr Word kVersionMask = kSLock - 1U;
+
+  /// @brief A bit mask for extracting an SIX/X-lock state and version values.
+  static constexpr Word kAllLockMask = static_cast<Word>(~kVersionMask);
+
+  /// @brief A bit mask for extracting X and SIX states.
+  static constexpr Word kXMask = kXLock | kSIXLock;
+
+  /// @brief A bit mask for extracting an S-lock state.
+  static constexpr Word kSMask = kAllLockMask ^ kXMask;
+
+  /// @brief A bit mask for extracting an X-lock state and version values.
+  static constexpr Word kXAndVersionMask = kXLock | kVersionMask;
+
   /*############################################################################
    * Internal APIs
    *##########################################################################*/
 
+  /**
+   * @brief Wait for an X lock to be released and read a version value.
+   *
+   * @return An empty guard instance with the current version value.
+   * @note This function is the slow path of `GetVersion` and is not inlined.
+   */
+  [[nodiscard]] auto GetVersionWithSpin()  //
+      -> OptGuard;
+
+  /**
+   * @brief Get a shared lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockS` and is not inlined.
+   */
+  [[nodiscard]] auto LockSWithSpin()  //
+      -> SGuard;
+
+  /**
+   * @brief Get a shared-with-intent-exclusive lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockSIX` and is not inlined.
+   */
+  [[nodiscard]] auto LockSIXWithSpin()  //
+      -> SIXGuard;
+
+  /**
+   * @brief Get an exclusive lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockX` and is not inlined.
+   */
+  [[nodiscard]] auto LockXWithSpin()  //
+      -> XGuard;
+
   /**
    * @brief Release a shared lock.
    *
    * @note If a thread calls this function without acquiring an S lock, it will
    * corrupt an internal lock state.
    */
-  void UnlockS();
+  void
+  UnlockS()
+  {
+    lock_.fetch_sub(kSLock, kRelaxed);
+  }
 
   /**
    * @brief Release a shared-with-intent-exclusive lock.
@@ -611,7 +754,11 @@ class OptimisticLock
    * @note If a thread calls this function without acquiring an SIX lock, it
    * will corrupt an internal lock state.
    */
-  void UnlockSIX();
+  void
+  UnlockSIX()
+  {
+    lock_.fetch_xor(kSIXLock, kRelaxed);
+  }
 
   /**
    * @brief Release an exclusive lock.
@@ -620,17 +767,165 @@ class OptimisticLock
    * @note If a thread calls this function without acquiring an X lock, it will
    * corrupt an internal lock state.
    */
-  void UnlockX(  //
-      uint64_t ver);
+  void
+  UnlockX(  //
+      const Word ver)
+  {
+    lock_.store(ver, kRelease);
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  static_assert(std::is_same_v<Word, uint64_t> || std::is_same_v<Word, uint32_t>
+                || std::is_same_v<Word, uint16_t>);
+  static_assert(std::atomic<Word>::is_always_lock_free);
 
   /*############################################################################
    * Internal member variables
    *##########################################################################*/
 
   /// @brief The current lock state.
-  std::atomic_uint64_t lock_{0};
+  std::atomic<Word> lock_{0};
 };
 
+/*##############################################################################
+ * Inline definitions of lock guards
+ *############################################################################*/
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::SGuard::operator=(  //
+    SGuard &&rhs) noexcept          //
+    -> SGuard &
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+template <class Word>
+BasicOptimisticLock<Word>::SGuard::~SGuard()
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+}
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::SIXGuard::operator=(  //
+    SIXGuard &&rhs) noexcept          //
+    -> SIXGuard &
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+template <class Word>
+BasicOptimisticLock<Word>::SIXGuard::~SIXGuard()
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+}
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::XGuard::operator=(  //
+    XGuard &&rhs) noexcept          //
+    -> XGuard &
+{
+  if (dest_) {
+    dest_->UnlockX(new_ver_);
+  }
+  dest_ = rhs.dest_;
+  old_ver_ = rhs.old_ver_;
+  new_ver_ = rhs.new_ver_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+template <class Word>
+BasicOptimisticLock<Word>::XGuard::~XGuard()
+{
+  if (dest_) {
+    dest_->UnlockX(new_ver_);
+  }
+}
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::XGuard::DowngradeToSIX()  //
+    -> SIXGuard
+{
+  if (dest_ == nullptr) return SIXGuard{};
+  auto *dest = dest_;
+  dest_ = nullptr;  // release the ownership
+
+  dest->lock_.store(new_ver_ | kSIXLock, kRelease);
+  return SIXGuard{dest};
+}
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::OptGuard::VerifyVersion()  //
+    -> bool
+{
+  std::atomic_thread_fence(kRelease);
+  const auto cur = dest_->lock_.load(kRelaxed);
+  if ((cur & kXLock) != kNoLocks) return VerifyVersionWithSpin();
+
+  const auto expected = ver_;
+  ver_ = static_cast<Version>(cur & kVersionMask);
+  return ver_ == expected;
+}
+
+template <class Word>
+auto
+BasicOptimisticLock<Word>::CompositeGuard::operator=(  //
+    CompositeGuard &&rhs) noexcept          //
+    -> CompositeGuard &
+{
+  if (has_lock_) {
+    dest_->UnlockS();
+  }
+  dest_ = rhs.dest_;
+  ver_ = rhs.ver_;
+  has_lock_ = rhs.has_lock_;
+  rhs.has_lock_ = false;
+  return *this;
+}
+
+template <class Word>
+BasicOptimisticLock<Word>::CompositeGuard::~CompositeGuard()
+{
+  if (has_lock_) {
+    dest_->UnlockS();
+  }
+}
+
+/*##############################################################################
+ * Aliases
+ *############################################################################*/
+
+/// @brief An optimistic lock with a 32-bit version in a 64-bit word.
+using OptimisticLock = BasicOptimisticLock<uint64_t>;
+
+/// @brief An optimistic lock with a 16-bit version in a 32-bit word.
+using OptimisticLock32 = BasicOptimisticLock<uint32_t>;
+
+/// @brief An optimistic lock with an 8-bit version in a 16-bit word.
+using OptimisticLock16 = BasicOptimisticLock<uint16_t>;
+
 }  // namespace dbgroup::lock
 
 #endif  // CPP_UTILITY_DBGROUP_LOCK_OPTIMISTIC_LOCK_HPP_
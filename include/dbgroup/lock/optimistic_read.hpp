@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_OPTIMISTIC_READ_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_OPTIMISTIC_READ_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+#include "dbgroup/lock/concepts.hpp"
+#include "dbgroup/lock/lock_adapter.hpp"
+
+namespace dbgroup::lock
+{
+/*##############################################################################
+ * Internal utilities
+ *############################################################################*/
+
+namespace component
+{
+/// @brief The maximum exponent for spinning between optimistic reads.
+constexpr size_t kMaxSpinShift = 10;
+
+/**
+ * @brief Wait before retrying an optimistic read.
+ *
+ * This function doubles the number of spinlock hints for each failure and
+ * sleeps if the failures exceed the number of spinlock retries.
+ *
+ * @param fail_num The number of failed optimistic reads.
+ */
+inline void
+BackoffForOptimisticRead(  //
+    const size_t fail_num)
+{
+  if (fail_num > kRetryNum) {
+    std::this_thread::sleep_for(kBackOffTime);
+    return;
+  }
+
+  const size_t spin_num = 1UL << (fail_num < kMaxSpinShift ? fail_num : kMaxSpinShift);
+  for (size_t i = 0; i < spin_num; ++i) {
+    CPP_UTILITY_SPINLOCK_HINT
+  }
+}
+
+/**
+ * @brief Run a given read procedure with optimistic locking and retries.
+ *
+ * @tparam Lock A class of optimistic locks.
+ * @tparam Func A class of read procedures.
+ * @param lock A target lock.
+ * @param fn A read procedure.
+ * @param retry_num The maximum number of failed optimistic runs.
+ * @return The result of the last (i.e., verified) run of a given procedure.
+ */
+template <OptimisticLockable Lock, class Func>
+auto
+OptimisticReadWithRetry(  //
+    Lock &lock,
+    Func &fn,
+    const size_t retry_num)  //
+    -> std::invoke_result_t<Func &>
+{
+  using Ret = std::invoke_result_t<Func &>;
+
+  auto &&guard = lock.GetVersion();
+  for (size_t fail_num = 0; fail_num < retry_num;) {
+    const auto ver = guard.GetVersion();
+    if constexpr (std::is_void_v<Ret>) {
+      fn();
+      std::atomic_thread_fence(kAcquire);
+      if (guard.VerifyVersion()) return;
+    } else {
+      Ret ret = fn();
+      std::atomic_thread_fence(kAcquire);
+      if (guard.VerifyVersion()) return ret;
+    }
+
+    // a failed guard has the current version, so count missed writes
+    const auto write_num = static_cast<decltype(ver)>(guard.GetVersion() - ver);
+    fail_num += write_num > 0 ? write_num : 1;
+    BackoffForOptimisticRead(fail_num);
+  }
+
+  [[maybe_unused]] const auto &pessimistic_guard = AcquireS(lock);
+  return fn();
+}
+
+}  // namespace component
+
+/*##############################################################################
+ * Public utilities
+ *############################################################################*/
+
+/**
+ * @brief Run a given read procedure with optimistic locking.
+ *
+ * This function runs a given procedure with a version of a target lock and
+ * retries it with adaptive back-off until the version is verified. Each
+ * failure counts the number of versions that writers have committed during the
+ * procedure, so frequent writers quickly exhaust retries. If retries are
+ * exhausted, this function acquires a shared lock (or an exclusive lock if a
+ * lock does not support shared ones) and runs the procedure pessimistically.
+ * Thus, the latency of reads is bounded even if writers are continuously
+ * modifying a shared region. If a lock does not support optimistic reads
+ * (e.g., `PessimisticLock`), this function always uses the pessimistic path.
+ *
+ * @tparam Lock A class of locks (e.g., `OptimisticLock` and `OptiQL`).
+ * @tparam Func A class of read procedures.
+ * @param lock A target lock.
+ * @param fn A read procedure that does not modify the shared region. The
+ * procedure must tolerate inconsistent values during optimistic runs.
+ * @param retry_num The maximum number of failed optimistic runs.
+ * @return The result of the last (i.e., verified) run of a given procedure.
+ */
+template <ExclusiveLockable Lock, class Func>
+auto
+OptimisticRead(  //
+    Lock &lock,
+    Func &&fn,
+    [[maybe_unused]] const size_t retry_num = kRetryNum)  //
+    -> std::invoke_result_t<Func &>
+{
+  if constexpr (!OptimisticLockable<Lock>) {
+    [[maybe_unused]] const auto &guard = AcquireS(lock);
+    return fn();
+  } else {
+    return component::OptimisticReadWithRetry(lock, fn, retry_num);
+  }
+}
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_OPTIMISTIC_READ_HPP_
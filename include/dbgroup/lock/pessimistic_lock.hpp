@@ -19,6 +19,10 @@
 
 // C++ standard libraries
 #include <atomic>
+#include <cstdint>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
 
 namespace dbgroup::lock
 {
@@ -283,8 +287,17 @@ class PessimisticLock
    * @note This function does not give up acquiring a lock and continues with
    * spinlock and back-off.
    */
-  [[nodiscard]] auto LockS()  //
-      -> SGuard;
+  [[nodiscard]] auto
+  LockS()  //
+      -> SGuard
+  {
+    auto cur = lock_.load(kRelaxed);
+    if ((cur & kXLock) == kNoLocks
+        && lock_.compare_exchange_weak(cur, cur + kSLock, kAcquire, kRelaxed)) {
+      return SGuard{this};
+    }
+    return LockSWithSpin();
+  }
 
   /**
    * @brief Get a shared-with-intent-exclusive lock.
@@ -293,8 +306,17 @@ class PessimisticLock
    * @note This function does not give up acquiring a lock and continues with
    * spinlock and back-off.
    */
-  [[nodiscard]] auto LockSIX()  //
-      -> SIXGuard;
+  [[nodiscard]] auto
+  LockSIX()  //
+      -> SIXGuard
+  {
+    auto cur = lock_.load(kRelaxed);
+    if ((cur & kXMask) == kNoLocks
+        && lock_.compare_exchange_weak(cur, cur | kSIXLock, kAcquire, kRelaxed)) {
+      return SIXGuard{this};
+    }
+    return LockSIXWithSpin();
+  }
 
   /**
    * @brief Get an exclusive lock.
@@ -303,21 +325,77 @@ class PessimisticLock
    * @note This function does not give up acquiring a lock and continues with
    * spinlock and back-off.
    */
-  [[nodiscard]] auto LockX()  //
-      -> XGuard;
+  [[nodiscard]] auto
+  LockX()  //
+      -> XGuard
+  {
+    auto cur = kNoLocks;
+    if (lock_.compare_exchange_weak(cur, kXLock, kAcquire, kRelaxed)) return XGuard{this};
+    return LockXWithSpin();
+  }
 
  private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A lock state representing no locks.
+  static constexpr uint64_t kNoLocks = 0b000UL;
+
+  /// @brief A lock state representing a shared lock.
+  static constexpr uint64_t kSLock = 0b001UL;
+
+  /// @brief A lock state representing a shared-with-intent-exclusive lock.
+  static constexpr uint64_t kSIXLock = 0b001UL << 62UL;
+
+  /// @brief A lock state representing an exclusive lock.
+  static constexpr uint64_t kXLock = 0b010UL << 62UL;
+
+  /// @brief A bit mask for extracting an SIX/X-lock state.
+  static constexpr uint64_t kXMask = kSIXLock | kXLock;
+
   /*############################################################################
    * Internal APIs
    *##########################################################################*/
 
+  /**
+   * @brief Get a shared lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockS` and is not inlined.
+   */
+  [[nodiscard]] auto LockSWithSpin()  //
+      -> SGuard;
+
+  /**
+   * @brief Get a shared-with-intent-exclusive lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockSIX` and is not inlined.
+   */
+  [[nodiscard]] auto LockSIXWithSpin()  //
+      -> SIXGuard;
+
+  /**
+   * @brief Get an exclusive lock with spinlock and back-off.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockX` and is not inlined.
+   */
+  [[nodiscard]] auto LockXWithSpin()  //
+      -> XGuard;
+
   /**
    * @brief Release a shared lock.
    *
    * @note If a thread calls this function without acquiring an S lock, it will
    * corrupt an internal lock state.
    */
-  void UnlockS();
+  void
+  UnlockS()
+  {
+    lock_.fetch_sub(kSLock, kRelaxed);
+  }
 
   /**
    * @brief Release a shared-with-intent-exclusive lock.
@@ -325,7 +403,11 @@ class PessimisticLock
    * @note If a thread calls this function without acquiring an SIX lock, it
    * will corrupt an internal lock state.
    */
-  void UnlockSIX();
+  void
+  UnlockSIX()
+  {
+    lock_.fetch_xor(kSIXLock, kRelaxed);
+  }
 
   /**
    * @brief Release an exclusive lock.
@@ -333,7 +415,11 @@ class PessimisticLock
    * @note If a thread calls this function without acquiring an X lock, it will
    * corrupt an internal lock state.
    */
-  void UnlockX();
+  void
+  UnlockX()
+  {
+    lock_.store(kNoLocks, kRelease);
+  }
 
   /*############################################################################
    * Internal member variables
@@ -343,6 +429,82 @@ class PessimisticLock
   std::atomic_uint64_t lock_{0};
 };
 
+/*##############################################################################
+ * Inline definitions of lock guards
+ *############################################################################*/
+
+inline auto
+PessimisticLock::SGuard::operator=(  //
+    SGuard &&rhs) noexcept           //
+    -> SGuard &
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PessimisticLock::SGuard::~SGuard()
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+}
+
+inline auto
+PessimisticLock::SIXGuard::operator=(  //
+    SIXGuard &&rhs) noexcept           //
+    -> SIXGuard &
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PessimisticLock::SIXGuard::~SIXGuard()
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+}
+
+inline auto
+PessimisticLock::XGuard::operator=(  //
+    XGuard &&rhs) noexcept           //
+    -> XGuard &
+{
+  if (dest_) {
+    dest_->UnlockX();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PessimisticLock::XGuard::~XGuard()
+{
+  if (dest_) {
+    dest_->UnlockX();
+  }
+}
+
+inline auto
+PessimisticLock::XGuard::DowngradeToSIX()  //
+    -> SIXGuard
+{
+  if (dest_ == nullptr) return SIXGuard{};
+  auto *dest = dest_;
+  dest_ = nullptr;  // release the ownership
+
+  dest->lock_.store(kSIXLock, kRelease);
+  return SIXGuard{dest};
+}
+
 }  // namespace dbgroup::lock
 
 #endif  // CPP_UTILITY_DBGROUP_LOCK_PESSIMISTIC_LOCK_HPP_
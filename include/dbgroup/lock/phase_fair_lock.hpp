@@ -0,0 +1,514 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_PHASE_FAIR_LOCK_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_PHASE_FAIR_LOCK_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstdint>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+
+namespace dbgroup::lock
+{
+/**
+ * @brief A class for representing a phase-fair reader-writer lock.
+ *
+ * Readers and writers alternate their phases, and writers (i.e., SIX and X
+ * locks) are ordered by tickets. Thus, a writer waits for at most one reader
+ * phase and the writers queued before it.
+ */
+class PhaseFairLock
+{
+ public:
+  /*############################################################################
+   * Public types
+   *##########################################################################*/
+
+  // forward declarations
+  class XGuard;
+
+  /**
+   * @brief A class for representing a guard instance for shared locks.
+   *
+   */
+  class SGuard
+  {
+   public:
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    constexpr SGuard() = default;
+
+    /**
+     * @param dest The address of a target lock.
+     */
+    constexpr explicit SGuard(  //
+        PhaseFairLock *dest)
+        : dest_{dest}
+    {
+    }
+
+    SGuard(const SGuard &) = delete;
+
+    constexpr SGuard(  //
+        SGuard &&obj) noexcept
+        : dest_{obj.dest_}
+    {
+      obj.dest_ = nullptr;
+    }
+
+    auto operator=(const SGuard &) -> SGuard & = delete;
+
+    auto operator=(             //
+        SGuard &&rhs) noexcept  //
+        -> SGuard &;
+
+    /*##########################################################################
+     * Public destructors
+     *########################################################################*/
+
+    /**
+     * @brief Destroy this instance and release a lock if holding.
+     *
+     */
+    ~SGuard();
+
+    /*##########################################################################
+     * Public APIs
+     *########################################################################*/
+
+    /**
+     * @retval true if this instance has the lock ownership.
+     * @retval false otherwise.
+     */
+    constexpr explicit
+    operator bool() const
+    {
+      return dest_;
+    }
+
+   private:
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// @brief The address of a target lock.
+    PhaseFairLock *dest_{nullptr};
+  };
+
+  /**
+   * @brief A class for representing a guard instance for SIX locks.
+   *
+   */
+  class SIXGuard
+  {
+   public:
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    constexpr SIXGuard() = default;
+
+    /**
+     * @param dest The address of a target lock.
+     */
+    constexpr explicit SIXGuard(  //
+        PhaseFairLock *dest)
+        : dest_{dest}
+    {
+    }
+
+    SIXGuard(const SIXGuard &) = delete;
+
+    constexpr SIXGuard(  //
+        SIXGuard &&obj) noexcept
+        : dest_{obj.dest_}
+    {
+      obj.dest_ = nullptr;
+    }
+
+    auto operator=(const SIXGuard &) -> SIXGuard & = delete;
+
+    auto operator=(               //
+        SIXGuard &&rhs) noexcept  //
+        -> SIXGuard &;
+
+    /*##########################################################################
+     * Public destructors
+     *########################################################################*/
+
+    /**
+     * @brief Destroy this instance and release a lock if holding.
+     *
+     */
+    ~SIXGuard();
+
+    /*##########################################################################
+     * Public APIs
+     *########################################################################*/
+
+    /**
+     * @retval true if this instance has the lock ownership.
+     * @retval false otherwise.
+     */
+    constexpr explicit
+    operator bool() const
+    {
+      return dest_;
+    }
+
+    /**
+     * @brief Upgrade this lock to an X lock.
+     *
+     * @return The lock guard for an X lock.
+     * @note After calling the function, this lock guard abandons the lock's
+     * ownership.
+     */
+    [[nodiscard]] auto UpgradeToX()  //
+        -> XGuard;
+
+   private:
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// @brief The address of a target lock.
+    PhaseFairLock *dest_{nullptr};
+  };
+
+  /**
+   * @brief A class for representing a guard instance for exclusive locks.
+   *
+   */
+  class XGuard
+  {
+   public:
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    constexpr XGuard() = default;
+
+    /**
+     * @param dest The address of a target lock.
+     */
+    constexpr explicit XGuard(  //
+        PhaseFairLock *dest)
+        : dest_{dest}
+    {
+    }
+
+    XGuard(const XGuard &) = delete;
+
+    constexpr XGuard(  //
+        XGuard &&obj) noexcept
+        : dest_{obj.dest_}
+    {
+      obj.dest_ = nullptr;
+    }
+
+    auto operator=(const XGuard &) -> XGuard & = delete;
+
+    auto operator=(             //
+        XGuard &&rhs) noexcept  //
+        -> XGuard &;
+
+    /*##########################################################################
+     * Public destructors
+     *########################################################################*/
+
+    /**
+     * @brief Destroy this instance and release a lock if holding.
+     *
+     */
+    ~XGuard();
+
+    /*##########################################################################
+     * Public APIs
+     *########################################################################*/
+
+    /**
+     * @retval true if this instance has the lock ownership.
+     * @retval false otherwise.
+     */
+    constexpr explicit
+    operator bool() const
+    {
+      return dest_;
+    }
+
+    /**
+     * @brief Downgrade this lock to an SIX lock.
+     *
+     * @return The lock guard for an SIX lock.
+     * @note After calling the function, this lock guard abandons the lock's
+     * ownership.
+     */
+    [[nodiscard]] auto DowngradeToSIX()  //
+        -> SIXGuard;
+
+   private:
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// @brief The address of a target lock.
+    PhaseFairLock *dest_{nullptr};
+  };
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr PhaseFairLock() = default;
+
+  PhaseFairLock(const PhaseFairLock &) = delete;
+  PhaseFairLock(PhaseFairLock &&) = delete;
+
+  auto operator=(const PhaseFairLock &) -> PhaseFairLock & = delete;
+  auto operator=(PhaseFairLock &&) -> PhaseFairLock & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~PhaseFairLock() = default;
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Get a shared lock.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note If a writer holds or waits for readers to drain, this function waits
+   * until the end of its phase with spinlock and back-off.
+   */
+  [[nodiscard]] auto
+  LockS()  //
+      -> SGuard
+  {
+    const auto w_bits = rin_.fetch_add(kRInc, kAcquire) & kWBits;
+    if ((w_bits & kWPresent) == 0) return SGuard{this};
+    return LockSWithSpin(w_bits);
+  }
+
+  /**
+   * @brief Get a shared-with-intent-exclusive lock.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function takes a writer ticket, so it waits for preceding SIX
+   * and X locks in FIFO order, but it does not block readers.
+   */
+  [[nodiscard]] auto LockSIX()  //
+      -> SIXGuard;
+
+  /**
+   * @brief Get an exclusive lock.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note This function waits for preceding SIX and X locks in FIFO order and
+   * then for the readers that arrived before it.
+   */
+  [[nodiscard]] auto LockX()  //
+      -> XGuard;
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A flag representing a writer holds or waits for the lock.
+  static constexpr uint32_t kWPresent = 0b010U;
+
+  /// @brief A bit for alternating the IDs of writer phases.
+  static constexpr uint32_t kPhaseID = 0b001U;
+
+  /// @brief A bit mask for extracting writer states.
+  static constexpr uint32_t kWBits = kWPresent | kPhaseID;
+
+  /// @brief An increment of reader counters.
+  static constexpr uint32_t kRInc = 1U << 8U;
+
+  /// @brief A bit mask for extracting reader counters.
+  static constexpr uint32_t kRCntMask = ~(kRInc - 1U);
+
+  /*############################################################################
+   * Internal APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Wait for the end of a given writer phase.
+   *
+   * @param w_bits Writer states when this thread has arrived.
+   * @return A guard instance for the acquired lock.
+   * @note This function is the slow path of `LockS` and is not inlined.
+   */
+  [[nodiscard]] auto LockSWithSpin(  //
+      uint32_t w_bits)               //
+      -> SGuard;
+
+  /**
+   * @brief Take a writer ticket and wait for preceding writers.
+   *
+   */
+  void AcquireTicket();
+
+  /**
+   * @brief Start a writer phase and wait for preceding readers.
+   *
+   * @note A calling thread must have its writer ticket.
+   */
+  void BlockReaders();
+
+  /**
+   * @brief Release a shared lock.
+   *
+   * @note If a thread calls this function without acquiring an S lock, it will
+   * corrupt an internal lock state.
+   */
+  void
+  UnlockS()
+  {
+    rout_.fetch_add(kRInc, kRelease);
+  }
+
+  /**
+   * @brief Release a shared-with-intent-exclusive lock.
+   *
+   * @note If a thread calls this function without acquiring an SIX lock, it
+   * will corrupt an internal lock state.
+   */
+  void
+  UnlockSIX()
+  {
+    wout_.fetch_add(1U, kRelease);
+  }
+
+  /**
+   * @brief Release an exclusive lock.
+   *
+   * @note If a thread calls this function without acquiring an X lock, it will
+   * corrupt an internal lock state.
+   */
+  void
+  UnlockX()
+  {
+    rin_.fetch_xor(kWPresent, kRelease);
+    wout_.fetch_add(1U, kRelease);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A reader counter for entries and writer states in the lower bits.
+  std::atomic_uint32_t rin_{0};
+
+  /// @brief A reader counter for exits.
+  std::atomic_uint32_t rout_{0};
+
+  /// @brief A ticket counter for writer entries.
+  std::atomic_uint32_t win_{0};
+
+  /// @brief A ticket counter for writer exits.
+  std::atomic_uint32_t wout_{0};
+};
+
+/*##############################################################################
+ * Inline definitions of lock guards
+ *############################################################################*/
+
+inline auto
+PhaseFairLock::SGuard::operator=(  //
+    SGuard &&rhs) noexcept         //
+    -> SGuard &
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PhaseFairLock::SGuard::~SGuard()
+{
+  if (dest_) {
+    dest_->UnlockS();
+  }
+}
+
+inline auto
+PhaseFairLock::SIXGuard::operator=(  //
+    SIXGuard &&rhs) noexcept         //
+    -> SIXGuard &
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PhaseFairLock::SIXGuard::~SIXGuard()
+{
+  if (dest_) {
+    dest_->UnlockSIX();
+  }
+}
+
+inline auto
+PhaseFairLock::XGuard::operator=(  //
+    XGuard &&rhs) noexcept         //
+    -> XGuard &
+{
+  if (dest_) {
+    dest_->UnlockX();
+  }
+  dest_ = rhs.dest_;
+  rhs.dest_ = nullptr;
+  return *this;
+}
+
+inline PhaseFairLock::XGuard::~XGuard()
+{
+  if (dest_) {
+    dest_->UnlockX();
+  }
+}
+
+inline auto
+PhaseFairLock::XGuard::DowngradeToSIX()  //
+    -> SIXGuard
+{
+  if (dest_ == nullptr) return SIXGuard{};
+  auto *dest = dest_;
+  dest_ = nullptr;  // release the ownership
+
+  dest->rin_.fetch_xor(kWPresent, kRelease);  // keep the writer ticket
+  return SIXGuard{dest};
+}
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_PHASE_FAIR_LOCK_HPP_
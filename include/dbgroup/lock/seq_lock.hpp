@@ -0,0 +1,247 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_SEQ_LOCK_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_SEQ_LOCK_HPP_
+
+// C++ standard libraries
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+
+namespace dbgroup::lock
+{
+/**
+ * @brief A class for representing values protected by sequence locks.
+ *
+ * This class uses the same layout of version words as `OptimisticLock` (i.e.,
+ * the most significant bit is an X-lock flag and the lower 32 bits are a
+ * version). Readers copy a value between two loads of the version word and
+ * never write to the shared cache line.
+ *
+ * @tparam T A class of protected values (must be trivially copyable).
+ * @tparam kMultiWriter A flag for allowing concurrent writers. If false,
+ * writers do not use any read-modify-write instructions, but callers must
+ * ensure that there is only one writer at a time.
+ */
+template <class T, bool kMultiWriter = true>
+class SeqLock
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr SeqLock() = default;
+
+  /**
+   * @param val An initial value.
+   */
+  constexpr explicit SeqLock(  //
+      const T &val)
+      : value_{val}
+  {
+  }
+
+  SeqLock(const SeqLock &) = delete;
+  SeqLock(SeqLock &&) = delete;
+
+  auto operator=(const SeqLock &) -> SeqLock & = delete;
+  auto operator=(SeqLock &&) -> SeqLock & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~SeqLock() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The current version (may be locked).
+   */
+  [[nodiscard]] auto
+  GetVersion() const  //
+      -> uint32_t
+  {
+    return static_cast<uint32_t>(ver_.load(kAcquire) & kVersionMask);
+  }
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Read a consistent copy of the protected value.
+   *
+   * @return A copy of the protected value.
+   * @note This function does not give up reading a value and continues with
+   * spinlock and back-off.
+   */
+  [[nodiscard]] auto
+  Read() const  //
+      -> T
+  {
+    Buffer buf;  // NOLINT
+    SpinWithBackoff([this, &buf]() -> bool { return TryCopy(buf); });
+    return std::bit_cast<T>(buf);
+  }
+
+  /**
+   * @brief Try reading a consistent copy of the protected value once.
+   *
+   * @param out An output value (undefined if this function fails).
+   * @retval true if this function reads a consistent value.
+   * @retval false if a writer is active or has modified the value.
+   */
+  [[nodiscard]] auto
+  TryRead(  //
+      T &out) const  //
+      -> bool
+  {
+    Buffer buf;  // NOLINT
+    if (!TryCopy(buf)) return false;
+    out = std::bit_cast<T>(buf);
+    return true;
+  }
+
+  /**
+   * @brief Overwrite the protected value.
+   *
+   * @param val A new value.
+   */
+  void
+  Write(  //
+      const T &val)
+  {
+    Update([&val](T &dest) { std::memcpy(&dest, &val, sizeof(T)); });
+  }
+
+  /**
+   * @brief Modify the protected value in place.
+   *
+   * @param func A function that receives a reference to the protected value.
+   * @note Concurrent readers may copy a partially modified value, but they
+   * always detect and discard it by version verification.
+   */
+  template <class Func>
+  void
+  Update(  //
+      Func &&func)
+  {
+    const auto cur = LockX();
+    std::forward<Func>(func)(value_);
+    ver_.store((cur + 1) & kVersionMask, kRelease);
+  }
+
+ private:
+  /*############################################################################
+   * Internal types
+   *##########################################################################*/
+
+  using Buffer = std::array<std::byte, sizeof(T)>;
+
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A lock state representing an exclusive lock.
+  static constexpr uint64_t kXLock = 1UL << 63UL;
+
+  /// @brief A bit mask for extracting version values.
+  static constexpr uint64_t kVersionMask = (1UL << 32UL) - 1UL;
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Set an X-lock flag for writing.
+   *
+   * @return The version word before locking.
+   */
+  auto
+  LockX()  //
+      -> uint64_t
+  {
+    uint64_t cur{};
+    if constexpr (kMultiWriter) {
+      SpinWithBackoff([this, &cur]() -> bool {
+        cur = ver_.load(kRelaxed);
+        return (cur & kXLock) == 0
+               && ver_.compare_exchange_weak(cur, cur | kXLock, kRelaxed, kRelaxed);
+      });
+    } else {
+      cur = ver_.load(kRelaxed);
+      ver_.store(cur | kXLock, kRelaxed);
+    }
+
+    // prevent the following writes from being reordered before the flag
+    std::atomic_thread_fence(kRelease);
+    return cur;
+  }
+
+  /**
+   * @param buf An output buffer.
+   * @retval true if the buffer has a consistent value.
+   * @retval false otherwise.
+   */
+  auto
+  TryCopy(  //
+      Buffer &buf) const  //
+      -> bool
+  {
+    const auto ver = ver_.load(kAcquire);
+    if (ver & kXLock) return false;
+
+    // the compiler can copy the value with wide loads
+    std::memcpy(buf.data(), &value_, sizeof(T));
+
+    // prevent the above reads from being reordered after the verification
+    std::atomic_thread_fence(kAcquire);
+    return ver_.load(kRelaxed) == ver;
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  static_assert(std::is_trivially_copyable_v<T>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The current version and lock state.
+  std::atomic_uint64_t ver_{0};
+
+  /// @brief A protected value.
+  T value_{};
+};
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_SEQ_LOCK_HPP_
@@ -0,0 +1,261 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_LOCK_TICKET_LOCK_HPP_
+#define CPP_UTILITY_DBGROUP_LOCK_TICKET_LOCK_HPP_
+
+// C++ standard libraries
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+
+namespace dbgroup::lock
+{
+/**
+ * @brief A class for representing (partitioned) ticket locks.
+ *
+ * A thread takes a ticket from a request counter and waits for the grant slot
+ * of its ticket (i.e., `ticket % kPartitionNum`) to reach the ticket. Since
+ * each grant slot has its own cache line, threads waiting for different slots
+ * do not invalidate each other's cache lines at every handover. Waiting
+ * threads pause in proportion to the number of tickets ahead of them.
+ *
+ * @tparam kPartitionNum The number of grant slots (must be a power of two). If
+ * one is given, this class is a simple ticket lock.
+ */
+template <size_t kPartitionNum = 4>
+class TicketLock
+{
+  static_assert(std::has_single_bit(kPartitionNum));
+
+ public:
+  /*############################################################################
+   * Public types
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing a guard instance for exclusive locks.
+   *
+   */
+  class XGuard
+  {
+   public:
+    /*##########################################################################
+     * Public constructors and assignment operators
+     *########################################################################*/
+
+    constexpr XGuard() = default;
+
+    /**
+     * @param dest The address of a target lock.
+     * @param ticket The ticket of this lock holder.
+     */
+    constexpr XGuard(  //
+        TicketLock *dest,
+        const uint32_t ticket)
+        : dest_{dest}, ticket_{ticket}
+    {
+    }
+
+    XGuard(const XGuard &) = delete;
+
+    constexpr XGuard(  //
+        XGuard &&obj) noexcept
+        : dest_{obj.dest_}, ticket_{obj.ticket_}
+    {
+      obj.dest_ = nullptr;
+    }
+
+    auto operator=(const XGuard &) -> XGuard & = delete;
+
+    auto
+    operator=(                  //
+        XGuard &&rhs) noexcept  //
+        -> XGuard &
+    {
+      if (dest_) {
+        dest_->UnlockX(ticket_);
+      }
+      dest_ = rhs.dest_;
+      ticket_ = rhs.ticket_;
+      rhs.dest_ = nullptr;
+      return *this;
+    }
+
+    /*##########################################################################
+     * Public destructors
+     *########################################################################*/
+
+    /**
+     * @brief Destroy this instance and release a lock if holding.
+     *
+     */
+    ~XGuard()
+    {
+      if (dest_) {
+        dest_->UnlockX(ticket_);
+      }
+    }
+
+    /*##########################################################################
+     * Public APIs
+     *########################################################################*/
+
+    /**
+     * @retval true if this instance has the lock ownership.
+     * @retval false otherwise.
+     */
+    constexpr explicit
+    operator bool() const
+    {
+      return dest_;
+    }
+
+   private:
+    /*##########################################################################
+     * Internal member variables
+     *########################################################################*/
+
+    /// @brief The address of a target lock.
+    TicketLock *dest_{nullptr};
+
+    /// @brief The ticket of this lock holder.
+    uint32_t ticket_{};
+  };
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  TicketLock()
+  {
+    // only the first ticket is granted at first
+    for (uint32_t i = 1; i < kPartitionNum; ++i) {
+      grants_[i].ticket.store(static_cast<uint32_t>(i - kPartitionNum), kRelaxed);
+    }
+  }
+
+  TicketLock(const TicketLock &) = delete;
+  TicketLock(TicketLock &&) = delete;
+
+  auto operator=(const TicketLock &) -> TicketLock & = delete;
+  auto operator=(TicketLock &&) -> TicketLock & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~TicketLock() = default;
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Get an exclusive lock.
+   *
+   * @return A guard instance for the acquired lock.
+   * @note Threads acquire this lock in FIFO order of their requests. This
+   * function pauses in proportion to the number of preceding tickets and
+   * yields a CPU core after `CPP_UTILITY_SPINLOCK_RETRY_NUM` failed checks.
+   */
+  [[nodiscard]] auto
+  LockX()  //
+      -> XGuard
+  {
+    const auto ticket = request_.fetch_add(1U, kRelaxed);
+    auto &grant = grants_[ticket & kPartitionMask].ticket;
+    for (size_t retry = 0; true; ++retry) {
+      const auto granted = grant.load(kAcquire);
+      if (granted == ticket) break;
+      if (retry >= kRetryNum) {
+        // a lock holder may be preempted, so give it a chance to run
+        std::this_thread::yield();
+        continue;
+      }
+
+      // each slot is granted once per kPartitionNum tickets
+      const size_t round = static_cast<uint32_t>(ticket - granted) / kPartitionNum;
+      for (size_t i = 0; i < round * kPauseNumPerRound; ++i) {
+        CPP_UTILITY_SPINLOCK_HINT
+      }
+    }
+    return XGuard{this, ticket};
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief A bit mask for computing slot positions.
+  static constexpr uint32_t kPartitionMask = kPartitionNum - 1;
+
+  /// @brief The number of spinlock hints for each preceding round of tickets.
+  static constexpr size_t kPauseNumPerRound = 16;
+
+  /*############################################################################
+   * Internal classes
+   *##########################################################################*/
+
+  /**
+   * @brief A grant slot padded to avoid false sharing.
+   *
+   */
+  struct alignas(kCacheLineSize) Grant {
+    /// @brief The ticket allowed to acquire this lock.
+    std::atomic_uint32_t ticket{};
+  };
+
+  /*############################################################################
+   * Internal APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Release an exclusive lock and pass it to the next ticket.
+   *
+   * @param ticket The ticket of a lock holder.
+   * @note If a thread calls this function without acquiring an X lock, it will
+   * corrupt an internal lock state.
+   */
+  void
+  UnlockX(  //
+      const uint32_t ticket)
+  {
+    const auto next = ticket + 1U;
+    grants_[next & kPartitionMask].ticket.store(next, kRelease);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A counter for issuing tickets.
+  alignas(kCacheLineSize) std::atomic_uint32_t request_{0};
+
+  /// @brief Grant slots for each partition of tickets.
+  std::array<Grant, kPartitionNum> grants_{};
+};
+
+}  // namespace dbgroup::lock
+
+#endif  // CPP_UTILITY_DBGROUP_LOCK_TICKET_LOCK_HPP_
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_COMMON_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_COMMON_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+/// @brief The number of random values generated at once in batch APIs.
+constexpr size_t kFillBatchSize = 256;
+
+/// @brief The number of significant bits in double-precision values.
+constexpr size_t kDoubleDigits = std::numeric_limits<double>::digits;
+
+/// @brief The unit of the least significant bit for [0, 1) values.
+constexpr double kDoubleUnit = 1.0 / static_cast<double>(1UL << kDoubleDigits);
+
+/// @brief The maximum value less than one.
+constexpr double kMaxUnitDouble = 1.0 - kDoubleUnit;
+
+/*##############################################################################
+ * Global utility functions
+ *############################################################################*/
+
+/**
+ * @param g A random value generator.
+ * @return A uniform random value in [0, 1) with 53-bit precision.
+ * @note If `g` generates full 64-bit values, this function uses their upper
+ * bits directly instead of `std::generate_canonical`.
+ */
+template <class RandEngine>
+[[nodiscard]] constexpr auto
+GenerateUnitDouble(  //
+    RandEngine &g)   //
+    -> double
+{
+  if constexpr (RandEngine::min() == 0
+                && RandEngine::max() == std::numeric_limits<uint64_t>::max()) {
+    return static_cast<double>(static_cast<uint64_t>(g()) >> (64 - kDoubleDigits)) * kDoubleUnit;
+  } else {
+    // some implementations may return one, so clamp it
+    const auto p = std::generate_canonical<double, kDoubleDigits>(g);
+    return p < kMaxUnitDouble ? p : kMaxUnitDouble;
+  }
+}
+
+/**
+ * @brief Fill a given buffer with random values in batches.
+ *
+ * This function separates the generation of uniform random values from their
+ * conversion. The first loop keeps the state of a generator hot, and the
+ * second loop has no dependencies between iterations, so CPUs can overlap
+ * independent conversions (e.g., binary searches and `std::pow` calls).
+ *
+ * @param out An output buffer.
+ * @param g A random value generator.
+ * @param to_val A function to convert [0, 1) values into output ones.
+ */
+template <class T, class RandEngine, class Converter>
+void
+FillWith(  //
+    std::span<T> out,
+    RandEngine &g,
+    const Converter &to_val)
+{
+  std::array<double, kFillBatchSize> probs;  // NOLINT
+  for (size_t i = 0; i < out.size(); i += kFillBatchSize) {
+    const auto n = std::min(kFillBatchSize, out.size() - i);
+    for (size_t j = 0; j < n; ++j) {
+      probs[j] = GenerateUnitDouble(g);
+    }
+    for (size_t j = 0; j < n; ++j) {
+      out[i + j] = to_val(probs[j]);
+    }
+  }
+}
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_COMMON_HPP_
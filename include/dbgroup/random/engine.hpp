@@ -0,0 +1,635 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_ENGINE_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_ENGINE_HPP_
+
+// C++ standard libraries
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// local sources
+#include "dbgroup/random/common.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+/// @brief The default seed value of random engines.
+constexpr uint64_t kDefaultSeed = 0x853C49E6748FEA9BUL;
+
+/*##############################################################################
+ * Global utility functions
+ *############################################################################*/
+
+/**
+ * @param a A multiplicand.
+ * @param b A multiplier.
+ * @param hi The upper 64 bits of the product.
+ * @return The lower 64 bits of the product.
+ */
+constexpr auto
+MulHiLo(  //
+    const uint64_t a,
+    const uint64_t b,
+    uint64_t &hi)  //
+    -> uint64_t
+{
+  const auto prod = static_cast<unsigned __int128>(a) * b;
+  hi = static_cast<uint64_t>(prod >> 64U);
+  return static_cast<uint64_t>(prod);
+}
+
+/**
+ * @brief A class to generate random values with SplitMix64.
+ *
+ * This engine has only 64-bit state, and `discard` and `Jump` work in O(1).
+ * This engine is also used for seeding the other engines.
+ */
+class SplitMix64
+{
+ public:
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of values skipped by `Jump`.
+  static constexpr uint64_t kJumpDistance = 1UL << 48UL;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param seed A seed value.
+   */
+  constexpr explicit SplitMix64(  //
+      const uint64_t seed = kDefaultSeed)
+      : state_{seed}
+  {
+  }
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @return The minimum value to be generated.
+   */
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  /**
+   * @return The maximum value to be generated.
+   */
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * @param seed A new seed value.
+   */
+  constexpr void
+  seed(  //
+      const uint64_t seed)
+  {
+    state_ = seed;
+  }
+
+  /**
+   * @return A random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    auto z = (state_ += kGamma);
+    z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9UL;
+    z = (z ^ (z >> 27U)) * 0x94D049BB133111EBUL;
+    return z ^ (z >> 31U);
+  }
+
+  /**
+   * @param n The number of values to be skipped.
+   */
+  constexpr void
+  discard(  //
+      const uint64_t n)
+  {
+    state_ += n * kGamma;
+  }
+
+  /**
+   * @brief Skip `kJumpDistance` values to create another stream.
+   *
+   */
+  constexpr void
+  Jump()
+  {
+    discard(kJumpDistance);
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The increment of internal states.
+  static constexpr uint64_t kGamma = 0x9E3779B97F4A7C15UL;
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An internal state.
+  uint64_t state_{};
+};
+
+/**
+ * @brief A class to generate random values with xoshiro256**.
+ *
+ * This engine has 256-bit state, and `Jump`/`LongJump` skip 2^128/2^192 values
+ * for parallel streams.
+ */
+class Xoshiro256StarStar
+{
+ public:
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param seed A seed value.
+   */
+  constexpr explicit Xoshiro256StarStar(  //
+      const uint64_t seed = kDefaultSeed)
+  {
+    this->seed(seed);
+  }
+
+  /**
+   * @param state An initial state (must not be all zeros).
+   */
+  constexpr explicit Xoshiro256StarStar(  //
+      const std::array<uint64_t, 4> &state)
+      : s_{state}
+  {
+  }
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @return The minimum value to be generated.
+   */
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  /**
+   * @return The maximum value to be generated.
+   */
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * @param seed A new seed value.
+   */
+  constexpr void
+  seed(  //
+      const uint64_t seed)
+  {
+    SplitMix64 g{seed};
+    for (auto &&s : s_) {
+      s = g();
+    }
+  }
+
+  /**
+   * @return A random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    const auto result = std::rotl(s_[1] * 5, 7) * 9;
+    const auto t = s_[1] << 17U;
+    s_[2] ^= s_[0];
+    s_[3] ^= s_[1];
+    s_[1] ^= s_[2];
+    s_[0] ^= s_[3];
+    s_[2] ^= t;
+    s_[3] = std::rotl(s_[3], 45);
+    return result;
+  }
+
+  /**
+   * @param n The number of values to be skipped.
+   */
+  constexpr void
+  discard(  //
+      uint64_t n)
+  {
+    for (; n > 0; --n) {
+      (*this)();
+    }
+  }
+
+  /**
+   * @brief Skip 2^128 values to create another stream.
+   *
+   */
+  constexpr void
+  Jump()
+  {
+    JumpWith({0x180EC6D33CFD0ABAUL, 0xD5A61266F0C9392CUL,  //
+              0xA9582618E03FC9AAUL, 0x39ABDC4529B1661CUL});
+  }
+
+  /**
+   * @brief Skip 2^192 values to create another set of streams.
+   *
+   */
+  constexpr void
+  LongJump()
+  {
+    JumpWith({0x76E15D3EFEFDCBBFUL, 0xC5004E441C522FB3UL,  //
+              0x77710069854EE241UL, 0x39109BB02ACBE635UL});
+  }
+
+ private:
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Advance the state by a jump polynomial.
+   *
+   * @param poly The coefficients of a jump polynomial.
+   */
+  constexpr void
+  JumpWith(  //
+      const std::array<uint64_t, 4> &poly)
+  {
+    std::array<uint64_t, 4> s{};
+    for (const auto p : poly) {
+      for (size_t b = 0; b < 64; ++b) {
+        if ((p >> b) & 1UL) {
+          for (size_t i = 0; i < s.size(); ++i) {
+            s[i] ^= s_[i];
+          }
+        }
+        (*this)();
+      }
+    }
+    s_ = s;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An internal state.
+  std::array<uint64_t, 4> s_{};
+};
+
+/**
+ * @brief A class to generate random values with wyrand.
+ *
+ * This engine has only 64-bit state and is one of the fastest engines, and
+ * `discard` and `Jump` work in O(1).
+ */
+class WyRand
+{
+ public:
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of values skipped by `Jump`.
+  static constexpr uint64_t kJumpDistance = 1UL << 48UL;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param seed A seed value.
+   */
+  constexpr explicit WyRand(  //
+      const uint64_t seed = kDefaultSeed)
+      : state_{seed}
+  {
+  }
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @return The minimum value to be generated.
+   */
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  /**
+   * @return The maximum value to be generated.
+   */
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * @param seed A new seed value.
+   */
+  constexpr void
+  seed(  //
+      const uint64_t seed)
+  {
+    state_ = seed;
+  }
+
+  /**
+   * @return A random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    state_ += kIncrement;
+    uint64_t hi{};
+    const auto lo = MulHiLo(state_, state_ ^ kMixer, hi);
+    return lo ^ hi;
+  }
+
+  /**
+   * @param n The number of values to be skipped.
+   */
+  constexpr void
+  discard(  //
+      const uint64_t n)
+  {
+    state_ += n * kIncrement;
+  }
+
+  /**
+   * @brief Skip `kJumpDistance` values to create another stream.
+   *
+   */
+  constexpr void
+  Jump()
+  {
+    discard(kJumpDistance);
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The increment of internal states.
+  static constexpr uint64_t kIncrement = 0xA0761D6478BD642FUL;
+
+  /// @brief A constant for mixing internal states.
+  static constexpr uint64_t kMixer = 0xE7037ED1A0B428DBUL;
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An internal state.
+  uint64_t state_{};
+};
+
+/**
+ * @brief A class to generate random values with Philox2x64-10.
+ *
+ * This engine is counter-based, so each value is computed from a key and a
+ * counter without sequential dependency. Thus, `discard` and `Jump` work in
+ * O(1), and each stream can be identified by its key or the upper counter.
+ */
+class Philox
+{
+ public:
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using result_type = uint64_t;
+
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The number of values generated by each block.
+  static constexpr size_t kBlockSize = 2;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @param seed A seed value used as a key.
+   */
+  constexpr explicit Philox(  //
+      const uint64_t seed = kDefaultSeed)
+      : key_{seed}
+  {
+  }
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @return The minimum value to be generated.
+   */
+  static constexpr auto
+  min()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::min();
+  }
+
+  /**
+   * @return The maximum value to be generated.
+   */
+  static constexpr auto
+  max()  //
+      -> result_type
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  /**
+   * @param seed A new seed value used as a key.
+   */
+  constexpr void
+  seed(  //
+      const uint64_t seed)
+  {
+    key_ = seed;
+    ctr_ = {};
+    pos_ = kBlockSize;
+  }
+
+  /**
+   * @return A random value.
+   */
+  constexpr auto
+  operator()()  //
+      -> result_type
+  {
+    if (pos_ == kBlockSize) {
+      block_ = Generate(ctr_, key_);
+      ++ctr_[0];
+      pos_ = 0;
+    }
+    return block_[pos_++];
+  }
+
+  /**
+   * @param n The number of values to be skipped.
+   */
+  constexpr void
+  discard(  //
+      uint64_t n)
+  {
+    const auto rest = kBlockSize - pos_;
+    if (n <= rest) {
+      pos_ += n;
+      return;
+    }
+    n -= rest;
+    ctr_[0] += n / kBlockSize;
+    pos_ = kBlockSize;
+    if (n % kBlockSize > 0) {
+      (*this)();
+      pos_ = n % kBlockSize;
+    }
+  }
+
+  /**
+   * @brief Skip 2^65 values to create another stream.
+   *
+   * This function increments the upper word of the counter, so streams do not
+   * overlap unless one of them generates 2^65 values.
+   */
+  constexpr void
+  Jump()
+  {
+    ++ctr_[1];
+  }
+
+  /**
+   * @param ctr A counter.
+   * @param key A key.
+   * @return Two random values for the given counter and key.
+   */
+  static constexpr auto
+  Generate(  //
+      std::array<uint64_t, kBlockSize> ctr,
+      uint64_t key)  //
+      -> std::array<uint64_t, kBlockSize>
+  {
+    for (size_t i = 0; i < kRoundNum; ++i) {
+      uint64_t hi{};
+      const auto lo = MulHiLo(kMultiplier, ctr[0], hi);
+      ctr = {hi ^ key ^ ctr[1], lo};
+      key += kWeyl;
+    }
+    return ctr;
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of rounds.
+  static constexpr size_t kRoundNum = 10;
+
+  /// @brief A multiplier for each round.
+  static constexpr uint64_t kMultiplier = 0xD2B74407B1CE6E93UL;
+
+  /// @brief A Weyl sequence constant for updating keys.
+  static constexpr uint64_t kWeyl = 0x9E3779B97F4A7C15UL;
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A key.
+  uint64_t key_{};
+
+  /// @brief The counter of the next block.
+  std::array<uint64_t, kBlockSize> ctr_{};
+
+  /// @brief The current block of random values.
+  std::array<uint64_t, kBlockSize> block_{};
+
+  /// @brief The position of the next value in the current block.
+  size_t pos_{kBlockSize};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_ENGINE_HPP_
@@ -0,0 +1,349 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_HOTSPOT_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_HOTSPOT_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/random/common.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Forward declarations
+ *############################################################################*/
+
+template <class IntType>
+class ShiftingHotspotDistribution;
+
+/**
+ * @brief A class to generate random values with a hotspot.
+ *
+ * A given fraction of accesses (e.g., 80%) goes to a hot set that consists of
+ * a given fraction of values (e.g., 20%), and values in each set are selected
+ * uniformly. Each sample takes O(1) time with one random value.
+ *
+ * @tparam IntType A class of generated random values.
+ */
+template <class IntType = size_t>
+class HotspotDistribution
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty distribution.
+   *
+   * This always returns zero.
+   */
+  HotspotDistribution();
+
+  /**
+   * @brief Construct a new distribution with given parameters.
+   *
+   * This distribution will generate random values within [`min`, `max`], and
+   * the hot set begins at `min`.
+   *
+   * @param min The minimum value to be generated.
+   * @param max The maximum value to be generated.
+   * @param hot_fraction The fraction of hot values in (0, 1].
+   * @param hot_prob The fraction of accesses to hot values in [0, 1].
+   * @throw std::runtime_error if the parameters are invalid or the range covers
+   * the whole 64-bit domain.
+   */
+  HotspotDistribution(  //
+      IntType min,
+      IntType max,
+      double hot_fraction,
+      double hot_prob);
+
+  constexpr HotspotDistribution(const HotspotDistribution &) = default;
+  constexpr HotspotDistribution(HotspotDistribution &&) noexcept = default;
+
+  constexpr auto operator=(const HotspotDistribution &obj)  //
+      -> HotspotDistribution & = default;
+  constexpr auto operator=(HotspotDistribution &&) noexcept  //
+      -> HotspotDistribution & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~HotspotDistribution() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The number of hot values.
+   */
+  [[nodiscard]] constexpr auto
+  GetHotNum() const  //
+      -> uint64_t
+  {
+    return hot_num_;
+  }
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param g A random value generator.
+   * @return A random value.
+   */
+  template <class RandEngine>
+  [[nodiscard]] auto
+  operator()(               //
+      RandEngine &g) const  //
+      -> IntType
+  {
+    return GetValue(GenerateUnitDouble(g), 0);
+  }
+
+  /**
+   * @brief Fill a given buffer with random values.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    FillWith(out, g, [this](const double p) { return GetValue(p, 0); });
+  }
+
+ private:
+  /*############################################################################
+   * Friend classes
+   *##########################################################################*/
+
+  friend class ShiftingHotspotDistribution<IntType>;
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param p A uniform random value in [0, 1).
+   * @param begin The position of the hot set in [0, `bin_num_`).
+   * @return The value corresponding to the given probability.
+   */
+  [[nodiscard]] constexpr auto
+  GetValue(  //
+      const double p,
+      const uint64_t begin) const  //
+      -> IntType
+  {
+    const auto pos = p < hot_prob_ ? static_cast<uint64_t>(p * hot_scale_)
+                                   : hot_num_ + static_cast<uint64_t>((p - hot_prob_) * cold_scale_);
+    // wrap around the range without overflowing 64-bit integers
+    const auto offset = std::min(pos, bin_num_ - 1);
+    const auto rest = bin_num_ - begin;
+    const auto id = offset < rest ? begin + offset : offset - rest;
+    return static_cast<IntType>(static_cast<uint64_t>(min_) + id);
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of integer types.
+  static_assert(std::is_same_v<IntType, uint32_t>     //
+                || std::is_same_v<IntType, uint64_t>  //
+                || std::is_same_v<IntType, int32_t>   //
+                || std::is_same_v<IntType, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The minimum value to be generated.
+  IntType min_{0};
+
+  /// @brief The number of values to be generated.
+  uint64_t bin_num_{1};
+
+  /// @brief The number of hot values.
+  uint64_t hot_num_{1};
+
+  /// @brief The fraction of accesses to hot values.
+  double hot_prob_{1.0};
+
+  /// @brief A scale for converting probabilities into hot values.
+  double hot_scale_{1.0};
+
+  /// @brief A scale for converting probabilities into cold values.
+  double cold_scale_{0.0};
+};
+
+/**
+ * @brief A class to generate random values with a drifting hotspot.
+ *
+ * The hot set of this distribution moves by `drift_rate` values per step and
+ * wraps around [`min`, `max`]. A step is a logical clock given by callers
+ * (e.g., the number of executed operations), so generated values are
+ * deterministic and threads do not share any counters.
+ *
+ * @tparam IntType A class of generated random values.
+ */
+template <class IntType = size_t>
+class ShiftingHotspotDistribution
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty distribution.
+   *
+   * This always returns zero.
+   */
+  ShiftingHotspotDistribution();
+
+  /**
+   * @brief Construct a new distribution with given parameters.
+   *
+   * @param min The minimum value to be generated.
+   * @param max The maximum value to be generated.
+   * @param hot_fraction The fraction of hot values in (0, 1].
+   * @param hot_prob The fraction of accesses to hot values in [0, 1].
+   * @param drift_rate The number of values the hot set moves per step.
+   * @throw std::runtime_error if the parameters are invalid or the range covers
+   * the whole 64-bit domain.
+   */
+  ShiftingHotspotDistribution(  //
+      IntType min,
+      IntType max,
+      double hot_fraction,
+      double hot_prob,
+      double drift_rate);
+
+  constexpr ShiftingHotspotDistribution(const ShiftingHotspotDistribution &) = default;
+  constexpr ShiftingHotspotDistribution(ShiftingHotspotDistribution &&) noexcept = default;
+
+  constexpr auto operator=(const ShiftingHotspotDistribution &obj)  //
+      -> ShiftingHotspotDistribution & = default;
+  constexpr auto operator=(ShiftingHotspotDistribution &&) noexcept  //
+      -> ShiftingHotspotDistribution & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~ShiftingHotspotDistribution() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @param step A logical clock.
+   * @return The first value of the hot set at the given step.
+   */
+  [[nodiscard]] constexpr auto
+  GetHotBegin(                    //
+      const uint64_t step) const  //
+      -> IntType
+  {
+    return static_cast<IntType>(static_cast<uint64_t>(base_.min_) + GetOffset(step));
+  }
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param g A random value generator.
+   * @param step A logical clock.
+   * @return A random value at the given step.
+   */
+  template <class RandEngine>
+  [[nodiscard]] auto
+  operator()(  //
+      RandEngine &g,
+      const uint64_t step) const  //
+      -> IntType
+  {
+    return base_.GetValue(GenerateUnitDouble(g), GetOffset(step));
+  }
+
+  /**
+   * @brief Fill a given buffer with random values at a given step.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   * @param step A logical clock.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g,
+      const uint64_t step) const
+  {
+    const auto begin = GetOffset(step);
+    FillWith(out, g, [&](const double p) { return base_.GetValue(p, begin); });
+  }
+
+ private:
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param step A logical clock.
+   * @return The offset of the hot set at the given step.
+   */
+  [[nodiscard]] auto
+  GetOffset(                      //
+      const uint64_t step) const  //
+      -> uint64_t
+  {
+    const auto bin_num = static_cast<double>(base_.bin_num_);
+    const auto offset = std::fmod(static_cast<double>(step) * drift_rate_, bin_num);
+    return std::min(static_cast<uint64_t>(offset), base_.bin_num_ - 1);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A base hotspot distribution.
+  HotspotDistribution<IntType> base_{};
+
+  /// @brief The number of values the hot set moves per step.
+  double drift_rate_{0.0};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_HOTSPOT_HPP_
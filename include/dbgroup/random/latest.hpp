@@ -0,0 +1,199 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_LATEST_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_LATEST_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/random/zipf.hpp"
+
+namespace dbgroup::random
+{
+/**
+ * @brief A class to generate recently added values according to Zipf's law.
+ *
+ * This class tracks a moving maximum value, and the maximum is the hottest
+ * one. Each sample subtracts an offset following Zipf's law from the current
+ * maximum, so it takes O(1) time regardless of the maximum.
+ *
+ * @tparam IntType A class of generated random values.
+ */
+template <class IntType = size_t>
+class LatestDistribution
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty distribution.
+   *
+   * This returns the current maximum value (zero by default).
+   */
+  LatestDistribution();
+
+  /**
+   * @brief Construct a new distribution with given parameters.
+   *
+   * This distribution will generate random values within [`min`, `max`] at
+   * first, and the window of the same width follows updates of the maximum.
+   *
+   * @param min The minimum value to be generated.
+   * @param max The initial maximum value to be generated.
+   * @param alpha A skew parameter (zero means uniform distribution).
+   */
+  LatestDistribution(  //
+      IntType min,
+      IntType max,
+      double alpha);
+
+  LatestDistribution(const LatestDistribution &obj);
+  LatestDistribution(LatestDistribution &&obj) noexcept;
+
+  auto operator=(const LatestDistribution &obj) -> LatestDistribution &;
+  auto operator=(LatestDistribution &&obj) noexcept -> LatestDistribution &;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~LatestDistribution() = default;
+
+  /*############################################################################
+   * Public getters/setters
+   *##########################################################################*/
+
+  /**
+   * @return The current maximum value.
+   */
+  [[nodiscard]] auto
+  GetMax() const  //
+      -> IntType
+  {
+    return max_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Update the maximum value if a given one is larger.
+   *
+   * This function is thread-safe, so worker threads can report their inserted
+   * values concurrently.
+   *
+   * @param val A newly added value.
+   */
+  void
+  Update(  //
+      const IntType val)
+  {
+    auto cur = max_.load(std::memory_order_relaxed);
+    while (cur < val
+           && !max_.compare_exchange_weak(cur, val, std::memory_order_relaxed,
+                                          std::memory_order_relaxed)) {
+      // continue until the maximum becomes larger than the given value
+    }
+  }
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param g A random value generator.
+   * @return A random value near the current maximum.
+   */
+  template <class RandEngine>
+  [[nodiscard]] auto
+  operator()(               //
+      RandEngine &g) const  //
+      -> IntType
+  {
+    return ToValue(zipf_(g), GetMax());
+  }
+
+  /**
+   * @brief Fill a given buffer with random values near the current maximum.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    zipf_.Fill(out, g);
+    const auto max = GetMax();
+    for (auto &&val : out) {
+      val = ToValue(val, max);
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param val A value generated by the base distribution.
+   * @param max The current maximum value.
+   * @return The value shifted to the current window.
+   */
+  [[nodiscard]] auto
+  ToValue(  //
+      const IntType val,
+      const IntType max) const  //
+      -> IntType
+  {
+    const auto offset = static_cast<uint64_t>(val) - static_cast<uint64_t>(min_);
+    return static_cast<IntType>(static_cast<uint64_t>(max) - offset);
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of integer types.
+  static_assert(std::is_same_v<IntType, uint32_t>     //
+                || std::is_same_v<IntType, uint64_t>  //
+                || std::is_same_v<IntType, int32_t>   //
+                || std::is_same_v<IntType, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The minimum value of the base distribution.
+  IntType min_{0};
+
+  /// @brief A base Zipf distribution for offsets from the current maximum.
+  ApproxZipfDistribution<IntType> zipf_{};
+
+  /// @brief The current maximum value.
+  std::atomic<IntType> max_{0};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_LATEST_HPP_
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_PERMUTATION_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_PERMUTATION_HPP_
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace dbgroup::random
+{
+/**
+ * @brief A class for representing seeded random permutations of a range.
+ *
+ * This class maps an index in [0, `max` - `min`] into a unique value in
+ * [`min`, `max`] without any storage. The mapping repeats xorshift and
+ * multiplication by odd constants over the smallest power-of-two domain
+ * covering all the values and uses cycle-walking to stay within the range.
+ * Since the domain is less than twice the range, each mapping takes expected
+ * O(1) time.
+ *
+ * @tparam IntType A class of permuted values.
+ */
+template <class IntType = size_t>
+class Permutation
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty permutation.
+   *
+   * This always returns zero.
+   */
+  Permutation();
+
+  /**
+   * @brief Construct a new permutation with given parameters.
+   *
+   * @param min The minimum value to be permuted.
+   * @param max The maximum value to be permuted.
+   * @param seed A seed value for permutation.
+   */
+  Permutation(  //
+      IntType min,
+      IntType max,
+      uint64_t seed = 0);
+
+  constexpr Permutation(const Permutation &) = default;
+  constexpr Permutation(Permutation &&) noexcept = default;
+
+  constexpr auto operator=(const Permutation &obj) -> Permutation & = default;
+  constexpr auto operator=(Permutation &&) noexcept -> Permutation & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~Permutation() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The number of permuted values.
+   * @note If this permutation covers the whole 64-bit domain, this function
+   * returns zero because 2^64 cannot be represented.
+   */
+  [[nodiscard]] constexpr auto
+  GetSize() const  //
+      -> uint64_t
+  {
+    return max_index_ + 1;
+  }
+
+  /**
+   * @brief Get a range of indices for a given thread.
+   *
+   * The ranges of all the threads are disjoint and cover [0, `GetSize()`), so
+   * threads can generate unique values without any coordination.
+   *
+   * @param thread_id The ID of a thread in [0, `thread_num`).
+   * @param thread_num The number of threads.
+   * @return The begin and end indices for the given thread.
+   * @note If this permutation covers the whole 64-bit domain, the end index of
+   * the last thread wraps around to zero.
+   */
+  [[nodiscard]] constexpr auto
+  GetPartition(  //
+      const size_t thread_id,
+      const size_t thread_num) const  //
+      -> std::pair<uint64_t, uint64_t>
+  {
+    // compute (max_index_ + 1) / thread_num without overflow
+    auto len = max_index_ / thread_num;
+    auto rem = max_index_ % thread_num + 1;
+    if (rem == thread_num) {
+      ++len;
+      rem = 0;
+    }
+    const auto begin = thread_id * len + std::min<uint64_t>(thread_id, rem);
+    return {begin, begin + len + static_cast<uint64_t>(thread_id < rem)};
+  }
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param index An index in [0, `GetSize()`).
+   * @return The value corresponding to the given index.
+   */
+  [[nodiscard]] auto
+  operator[](                      //
+      const uint64_t index) const  //
+      -> IntType
+  {
+    auto x = Permute(index);
+    while (x > max_index_) {  // cycle-walking
+      x = Permute(x);
+    }
+    return static_cast<IntType>(static_cast<uint64_t>(min_) + x);
+  }
+
+  /**
+   * @param val A value in [`min`, `max`].
+   * @return The index of the given value (i.e., the inverse of `operator[]`).
+   */
+  [[nodiscard]] auto
+  Inverse(                      //
+      const IntType val) const  //
+      -> uint64_t
+  {
+    auto x = Unpermute(static_cast<uint64_t>(val) - static_cast<uint64_t>(min_));
+    while (x > max_index_) {  // cycle-walking
+      x = Unpermute(x);
+    }
+    return x;
+  }
+
+  /**
+   * @brief Fill a given buffer with permuted values of consecutive indices.
+   *
+   * @param out An output buffer.
+   * @param begin The index of the first value.
+   */
+  void
+  Fill(  //
+      std::span<IntType> out,
+      const uint64_t begin) const
+  {
+    for (size_t i = 0; i < out.size(); ++i) {
+      out[i] = (*this)[begin + i];
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of mixing rounds.
+  static constexpr size_t kRoundNum = 3;
+
+  /// @brief Odd multipliers for mixing rounds.
+  static constexpr std::array<uint64_t, kRoundNum> kMultipliers{
+      0x9E3779B97F4A7C15UL,
+      0xBF58476D1CE4E5B9UL,
+      0x94D049BB133111EBUL,
+  };
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param x An odd value.
+   * @return The multiplicative inverse of the given value modulo 2^64.
+   */
+  [[nodiscard]] static constexpr auto
+  GetInverse(            //
+      const uint64_t x)  //
+      -> uint64_t
+  {
+    auto inv = x;  // correct in the lowest three bits
+    for (size_t i = 0; i < 5; ++i) {
+      inv *= 2 - x * inv;  // Newton's method doubles the correct bits
+    }
+    return inv;
+  }
+
+  /// @brief The multiplicative inverses of `kMultipliers`.
+  static constexpr std::array<uint64_t, kRoundNum> kInvMultipliers{
+      GetInverse(kMultipliers[0]),
+      GetInverse(kMultipliers[1]),
+      GetInverse(kMultipliers[2]),
+  };
+
+  /**
+   * @param x A value in [0, 2^`bits_`).
+   * @return A permuted value in [0, 2^`bits_`).
+   */
+  [[nodiscard]] auto
+  Permute(               //
+      uint64_t x) const  //
+      -> uint64_t
+  {
+    for (size_t i = 0; i < kRoundNum; ++i) {
+      x ^= x >> shift_;
+      x = (x * kMultipliers[i] + keys_[i]) & mask_;
+    }
+    return x;
+  }
+
+  /**
+   * @param x A value in [0, 2^`bits_`).
+   * @return The inverse of `Permute`.
+   */
+  [[nodiscard]] auto
+  Unpermute(             //
+      uint64_t x) const  //
+      -> uint64_t
+  {
+    for (size_t i = kRoundNum; i > 0; --i) {
+      x = ((x - keys_[i - 1]) * kInvMultipliers[i - 1]) & mask_;
+      auto y = x;
+      for (auto s = shift_; s < bits_; s += shift_) {  // undo the xorshift
+        y = x ^ (y >> shift_);
+      }
+      x = y;
+    }
+    return x;
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of integer types.
+  static_assert(std::is_same_v<IntType, uint32_t>     //
+                || std::is_same_v<IntType, uint64_t>  //
+                || std::is_same_v<IntType, int32_t>   //
+                || std::is_same_v<IntType, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The minimum value to be permuted.
+  IntType min_{0};
+
+  /// @brief The maximum index (i.e., the number of values minus one).
+  uint64_t max_index_{0};
+
+  /// @brief The number of bits in the permuted domain.
+  uint64_t bits_{1};
+
+  /// @brief The shift width of xorshift operations.
+  uint64_t shift_{1};
+
+  /// @brief A bitmask for the permuted domain.
+  uint64_t mask_{1};
+
+  /// @brief Keys for mixing rounds.
+  std::array<uint64_t, kRoundNum> keys_{};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_PERMUTATION_HPP_
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_SCRAMBLED_ZIPF_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_SCRAMBLED_ZIPF_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/random/permutation.hpp"
+#include "dbgroup/random/zipf.hpp"
+
+namespace dbgroup::random
+{
+/**
+ * @brief A class to generate random values according to Zipf's law with
+ * scattered hot values.
+ *
+ * This class maps the ranks generated by a base Zipf distribution into
+ * [`min`, `max`] by using a seeded `Permutation`, so hot values do not cluster
+ * around `min`.
+ *
+ * @tparam IntType A class of generated random values.
+ * @tparam Base A class of base Zipf distributions.
+ */
+template <class IntType = size_t, class Base = ZipfDistribution<IntType>>
+class ScrambledZipfDistribution
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty distribution.
+   *
+   * This always returns zero.
+   */
+  ScrambledZipfDistribution();
+
+  /**
+   * @brief Construct a new Zipf distribution with given parameters.
+   *
+   * @param min The minimum value to be generated.
+   * @param max The maximum value to be generated.
+   * @param alpha A skew parameter (zero means uniform distribution).
+   * @param seed A seed value for permutation.
+   */
+  ScrambledZipfDistribution(  //
+      IntType min,
+      IntType max,
+      double alpha,
+      uint64_t seed = 0);
+
+  ScrambledZipfDistribution(const ScrambledZipfDistribution &) = default;
+  ScrambledZipfDistribution(ScrambledZipfDistribution &&) noexcept = default;
+
+  auto operator=(const ScrambledZipfDistribution &obj) -> ScrambledZipfDistribution & = default;
+  auto operator=(ScrambledZipfDistribution &&) noexcept -> ScrambledZipfDistribution & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~ScrambledZipfDistribution() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @param rank A rank in [0, `bin_num`) (zero is the most frequent one).
+   * @return The value corresponding to the given rank.
+   */
+  [[nodiscard]] auto
+  GetValue(                       //
+      const uint64_t rank) const  //
+      -> IntType
+  {
+    return perm_[rank];
+  }
+
+  /**
+   * @param val A value in [`min`, `max`].
+   * @return The rank of the given value (i.e., the inverse of `GetValue`).
+   */
+  [[nodiscard]] auto
+  GetRank(                      //
+      const IntType val) const  //
+      -> uint64_t
+  {
+    return perm_.Inverse(val);
+  }
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param g A random value generator.
+   * @return A random value according to Zipf's law.
+   */
+  template <class RandEngine>
+  [[nodiscard]] auto
+  operator()(               //
+      RandEngine &g) const  //
+      -> IntType
+  {
+    return GetValue(ToRank(base_(g)));
+  }
+
+  /**
+   * @brief Fill a given buffer with random values according to Zipf's law.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    base_.Fill(out, g);
+    for (auto &&val : out) {
+      val = GetValue(ToRank(val));
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param val A value generated by the base distribution.
+   * @return The rank of the given value.
+   */
+  [[nodiscard]] auto
+  ToRank(                       //
+      const IntType val) const  //
+      -> uint64_t
+  {
+    return static_cast<uint64_t>(val) - static_cast<uint64_t>(min_);
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of integer types.
+  static_assert(std::is_same_v<IntType, uint32_t>     //
+                || std::is_same_v<IntType, uint64_t>  //
+                || std::is_same_v<IntType, int32_t>   //
+                || std::is_same_v<IntType, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The minimum value to be generated.
+  IntType min_{0};
+
+  /// @brief A permutation for mapping ranks into values.
+  Permutation<IntType> perm_{};
+
+  /// @brief A base Zipf distribution.
+  Base base_{};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_SCRAMBLED_ZIPF_HPP_
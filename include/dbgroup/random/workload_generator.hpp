@@ -0,0 +1,377 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_RANDOM_WORKLOAD_GENERATOR_HPP_
+#define CPP_UTILITY_DBGROUP_RANDOM_WORKLOAD_GENERATOR_HPP_
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// local sources
+#include "dbgroup/random/engine.hpp"
+#include "dbgroup/random/hotspot.hpp"
+#include "dbgroup/random/latest.hpp"
+#include "dbgroup/random/scrambled_zipf.hpp"
+#include "dbgroup/random/zipf.hpp"
+#include "dbgroup/thread/common.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Global enums and structs
+ *############################################################################*/
+
+/**
+ * @brief A list of operation types.
+ *
+ */
+enum class OpType : uint32_t {
+  kRead = 0,
+  kUpdate,
+  kInsert,
+  kScan,
+  kReadModifyWrite,
+};
+
+/**
+ * @brief A list of distributions for selecting existing keys.
+ *
+ */
+enum class KeyDistribution : uint32_t {
+  /// @brief Select keys uniformly.
+  kUniform = 0,
+
+  /// @brief Select keys according to Zipf's law (smaller keys are hotter).
+  kZipf,
+
+  /// @brief Select keys according to Zipf's law and scatter hot keys.
+  kScrambledZipf,
+
+  /// @brief Select recently inserted keys according to Zipf's law.
+  kLatest,
+
+  /// @brief Select keys in a hot set with a given probability.
+  kHotspot,
+
+  /// @brief Select keys in a drifting hot set with a given probability.
+  kShiftingHotspot,
+};
+
+/**
+ * @brief A list of distributions for scan lengths.
+ *
+ */
+enum class LengthDistribution : uint32_t {
+  kUniform = 0,
+  kZipf,
+};
+
+/**
+ * @brief A class for representing generated operations.
+ *
+ */
+struct Operation {
+  /// @brief The type of this operation.
+  OpType type{OpType::kRead};
+
+  /// @brief A scan length for scan operations or a value size for the others.
+  uint32_t len{};
+
+  /// @brief A target key (the begin key for scan operations).
+  uint64_t key{};
+};
+
+/**
+ * @brief A class for representing the proportions of operations.
+ *
+ * The proportions do not need to be normalized.
+ */
+struct OperationMix {
+  /// @brief The proportion of read operations.
+  double read{};
+
+  /// @brief The proportion of update operations.
+  double update{};
+
+  /// @brief The proportion of insert operations.
+  double insert{};
+
+  /// @brief The proportion of scan operations.
+  double scan{};
+
+  /// @brief The proportion of read-modify-write operations.
+  double read_modify_write{};
+};
+
+/**
+ * @brief A class for representing the configurations of workloads.
+ *
+ */
+struct WorkloadConfig {
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The default number of initial records.
+  static constexpr uint64_t kDefaultRecordNum = 1000000;
+
+  /// @brief The default skew parameter (the same as YCSB).
+  static constexpr double kDefaultSkew = 0.99;
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Create the configuration of a YCSB core workload.
+   *
+   * @param type A workload type in [A, F].
+   * @param record_num The number of initial records.
+   * @return The configuration of the given workload.
+   * @note Workload D uses the latest distribution, and the others use the
+   * scrambled Zipf distribution.
+   * @throw std::runtime_error if the given type is unknown.
+   */
+  [[nodiscard]] static auto YCSB(  //
+      char type,
+      uint64_t record_num = kDefaultRecordNum)  //
+      -> WorkloadConfig;
+
+  /*############################################################################
+   * Public member variables
+   *##########################################################################*/
+
+  /// @brief The proportions of operations.
+  OperationMix mix{.read = 1.0};
+
+  /// @brief The number of initial records (i.e., keys in [0, `record_num`)).
+  uint64_t record_num{kDefaultRecordNum};
+
+  /// @brief A distribution for selecting existing keys.
+  KeyDistribution key_dist{KeyDistribution::kZipf};
+
+  /// @brief A skew parameter for Zipf distributions.
+  double skew{kDefaultSkew};
+
+  /// @brief The fraction of hot keys for hotspot distributions.
+  double hot_fraction{0.2};
+
+  /// @brief The fraction of accesses to hot keys for hotspot distributions.
+  double hot_prob{0.8};
+
+  /// @brief The number of keys the hot set moves per operation.
+  double drift_rate{0.01};
+
+  /// @brief The minimum value size.
+  uint32_t min_value_size{100};
+
+  /// @brief The maximum value size.
+  uint32_t max_value_size{100};
+
+  /// @brief A distribution for scan lengths.
+  LengthDistribution scan_dist{LengthDistribution::kUniform};
+
+  /// @brief The maximum scan length.
+  uint32_t max_scan_length{100};
+};
+
+/**
+ * @brief A class to generate operation streams for benchmarks.
+ *
+ * Each thread has its own random engine jumped by its ID, so a stream of each
+ * thread is deterministic for the same seed regardless of the others. Insert
+ * operations create new keys partitioned by thread IDs (i.e., the `i`-th
+ * insert key of the `t`-th thread is `record_num + t + i * thread_num`).
+ *
+ * The latest distribution of each stream tracks only the initial records and
+ * the keys inserted by its own thread, so a stream never reads keys that its
+ * thread has not inserted yet. The other distributions select keys only from
+ * the initial records (unlike YCSB, which extends them to inserted keys).
+ */
+class WorkloadGenerator
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new generator.
+   *
+   * @param config The configuration of a workload.
+   * @param thread_num The number of worker threads.
+   * @param seed A seed value for random engines.
+   * @throw std::runtime_error if the configuration is invalid.
+   */
+  WorkloadGenerator(  //
+      const WorkloadConfig &config,
+      size_t thread_num = 1,
+      uint64_t seed = kDefaultSeed);
+
+  WorkloadGenerator(const WorkloadGenerator &) = delete;
+  WorkloadGenerator(WorkloadGenerator &&) noexcept = default;
+
+  auto operator=(const WorkloadGenerator &obj) -> WorkloadGenerator & = delete;
+  auto operator=(WorkloadGenerator &&) noexcept -> WorkloadGenerator & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~WorkloadGenerator() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The configuration of this workload.
+   */
+  [[nodiscard]] auto
+  GetConfig() const  //
+      -> const WorkloadConfig &
+  {
+    return config_;
+  }
+
+  /**
+   * @param thread_id The ID of a worker thread.
+   * @return The number of keys inserted by the given thread.
+   */
+  [[nodiscard]] auto
+  GetInsertedNum(                    //
+      const size_t thread_id) const  //
+      -> uint64_t
+  {
+    return streams_[thread_id].insert_num;
+  }
+
+  /*############################################################################
+   * Public utilities
+   *##########################################################################*/
+
+  /**
+   * @param thread_id The ID of a worker thread in [0, `thread_num`).
+   * @return The next operation of the given thread.
+   * @note Only the thread with the given ID can call this function.
+   */
+  auto Next(              //
+      size_t thread_id)  //
+      -> Operation;
+
+  /**
+   * @brief Fill a given buffer with the next operations of a given thread.
+   *
+   * @param thread_id The ID of a worker thread in [0, `thread_num`).
+   * @param out An output buffer.
+   * @note Only the thread with the given ID can call this function.
+   */
+  void Fill(  //
+      size_t thread_id,
+      std::span<Operation> out);
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of operation types.
+  static constexpr size_t kOpTypeNum = 5;
+
+  /*############################################################################
+   * Internal structs
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing thread local streams.
+   *
+   */
+  struct alignas(thread::kCashLineSize) Stream {
+    /// @brief A random engine of this thread.
+    Xoshiro256StarStar engine{};
+
+    /// @brief The number of keys inserted by this thread.
+    uint64_t insert_num{};
+
+    /// @brief The next key to be inserted by this thread.
+    uint64_t next_key{};
+
+    /// @brief The number of operations generated by this thread.
+    uint64_t op_num{};
+
+    /// @brief A latest distribution over the keys visible to this thread.
+    LatestDistribution<uint64_t> latest{};
+  };
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @param s A thread local stream.
+   * @return The next operation of the given stream.
+   */
+  auto Generate(  //
+      Stream &s)  //
+      -> Operation;
+
+  /**
+   * @param s A thread local stream.
+   * @return An existing key.
+   */
+  auto GetExistingKey(  //
+      Stream &s)        //
+      -> uint64_t;
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The configuration of this workload.
+  WorkloadConfig config_{};
+
+  /// @brief The number of worker threads.
+  size_t thread_num_{1};
+
+  /// @brief The CDF of operation types.
+  std::array<double, kOpTypeNum> op_cdf_{};
+
+  /// @brief A Zipf distribution for ranks of existing keys.
+  ZipfDistribution<uint64_t> zipf_{};
+
+  /// @brief A scrambled Zipf distribution for existing keys.
+  ScrambledZipfDistribution<uint64_t> scrambled_zipf_{};
+
+  /// @brief A hotspot distribution for existing keys.
+  HotspotDistribution<uint64_t> hotspot_{};
+
+  /// @brief A shifting hotspot distribution for existing keys.
+  ShiftingHotspotDistribution<uint64_t> shifting_hotspot_{};
+
+  /// @brief A Zipf distribution for scan lengths.
+  ApproxZipfDistribution<uint32_t> scan_zipf_{};
+
+  /// @brief Thread local streams.
+  std::vector<Stream> streams_{};
+};
+
+}  // namespace dbgroup::random
+
+#endif  // CPP_UTILITY_DBGROUP_RANDOM_WORKLOAD_GENERATOR_HPP_
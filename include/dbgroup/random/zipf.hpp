@@ -18,14 +18,21 @@
 #define CPP_UTILITY_DBGROUP_RANDOM_ZIPF_HPP_
 
 // C++ standard libraries
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <memory>
 #include <random>
+#include <span>
 #include <type_traits>
 #include <vector>
 
+// local sources
+#include "dbgroup/random/common.hpp"
+
 namespace dbgroup::random
 {
 /**
@@ -54,14 +61,22 @@ class ZipfDistribution
    * This distribution will generate random values within [`min`, `max`]
    * according to Zipf's law with a skew paramter `alpha`.
    *
+   * If `cache_dir` is given, this constructor first tries to map a cached CDF
+   * file for the same parameters. If there is no such file, this constructor
+   * computes a CDF and stores it into the directory for subsequent processes.
+   *
    * @param min The minimum value to be generated.
    * @param max The maximum value to be generated.
    * @param alpha A skew parameter (zero means uniform distribution).
+   * @param thread_num The number of threads for computing a CDF.
+   * @param cache_dir A directory for caching CDF files (empty means no cache).
    */
   ZipfDistribution(  //
       IntType min,
       IntType max,
-      double alpha);
+      double alpha,
+      size_t thread_num = 1,
+      const std::filesystem::path &cache_dir = {});
 
   ZipfDistribution(const ZipfDistribution &) = default;
   ZipfDistribution(ZipfDistribution &&) noexcept = default;
@@ -83,14 +98,45 @@ class ZipfDistribution
    * @param id A target ID in [0, `bin_num`).
    * @return A CDF value of the given ID.
    */
-  [[nodiscard]] constexpr auto
+  [[nodiscard]] auto
   GetCDF(                      //
       const IntType id) const  //
       -> double
   {
-    return zipf_cdf_.at(id);
+    const auto pos = static_cast<size_t>(id);
+    if (pos + 1 >= bin_num_) return 1.0;
+    if (pos < zipf_cdf_.size()) return zipf_cdf_[pos] * base_prob_;
+
+    // accumulate the weights in the target block
+    const auto block = (pos - zipf_cdf_.size()) / kBlockSize;
+    const auto begin = zipf_cdf_.size() + block * kBlockSize;
+    if (pos + 1 == begin + kBlockSize) return block_cdf_[block] * base_prob_;
+    auto cdf = block == 0 ? zipf_cdf_.back() : block_cdf_[block - 1];
+    for (auto i = begin; i <= pos; ++i) {
+      cdf += GetWeight(i);
+    }
+    return std::min(cdf, block_cdf_[block]) * base_prob_;
   }
 
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Extend the range of this distribution to a given maximum value.
+   *
+   * This function appends the weights of new bins to the CDF and only updates
+   * the normalization constant, so it takes amortized O(`new_max` - `max`)
+   * time. If the CDF is shared with copied instances or mapped from a cache
+   * file, this function first copies it into a private storage.
+   *
+   * @param new_max A new maximum value.
+   * @throw std::runtime_error if the given value is less than the maximum.
+   * @note This function is not thread-safe with sampling.
+   */
+  void ExtendRange(  //
+      IntType new_max);
+
   /*############################################################################
    * Public utility operators
    *##########################################################################*/
@@ -106,39 +152,137 @@ class ZipfDistribution
       -> IntType
   {
     thread_local std::uniform_real_distribution<double> uniform_dist{0.0, 1.0};  // NOLINT
-    const auto target_prob = uniform_dist(g);
-
-    // find a target bin by using a binary search
-    int64_t begin_pos = 0;
-    int64_t end_pos = zipf_cdf_.size() - 1;
-    while (begin_pos < end_pos) {
-      auto pos = (begin_pos + end_pos) >> 1UL;  // NOLINT
-      const auto cdf_val = zipf_cdf_.at(pos);
-      if (target_prob < cdf_val) {
-        end_pos = pos - 1;
-      } else if (target_prob > cdf_val) {
-        begin_pos = pos + 1;
-      } else {  // target_prob == cdf_val
-        begin_pos = pos;
-        break;
-      }
-    }
-    if (target_prob > zipf_cdf_.at(begin_pos)) {
-      ++begin_pos;
-    }
+    return GetID(uniform_dist(g));
+  }
 
-    return min_ + static_cast<IntType>(begin_pos);
+  /**
+   * @brief Fill a given buffer with random values according to Zipf's law.
+   *
+   * This function generates uniform random values in batches and then converts
+   * them into IDs, so it is faster than calling `operator()` repeatedly.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    FillWith(out, g, [this](const double p) { return GetID(p); });
   }
 
  private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The maximum number of head bins that retain exact CDF values.
+  static constexpr size_t kHeadBinNum = 1UL << 16UL;
+
+  /// @brief The number of tail bins summarized by each CDF value.
+  static constexpr size_t kBlockSize = 64;
+
   /*############################################################################
    * Internal utility functions
    *##########################################################################*/
 
+  /**
+   * @param pos The position of a bin.
+   * @return The unnormalized probability of the given bin.
+   */
+  [[nodiscard]] auto
+  GetWeight(                   //
+      const size_t pos) const  //
+      -> double
+  {
+    return 1.0 / std::pow(static_cast<double>(pos + 1), alpha_);
+  }
+
+  /**
+   * @param target_prob A uniform random value in [0, 1).
+   * @return The ID corresponding to the given probability.
+   */
+  [[nodiscard]] auto
+  GetID(                               //
+      const double target_prob) const  //
+      -> IntType
+  {
+    // CDF values are unnormalized, so scale the probability instead
+    const auto target = target_prob * weight_sum_;
+
+    // find a target bin in the head by using a binary search
+    if (block_cdf_.empty() || target <= zipf_cdf_.back()) {
+      const auto &it = std::lower_bound(zipf_cdf_.begin(), zipf_cdf_.end() - 1, target);
+      return min_ + static_cast<IntType>(it - zipf_cdf_.begin());
+    }
+
+    // find a target block in the tail by using a binary search
+    const auto &it = std::lower_bound(block_cdf_.begin(), block_cdf_.end() - 1, target);
+    const size_t block = it - block_cdf_.begin();
+    const auto low = block == 0 ? zipf_cdf_.back() : block_cdf_[block - 1];
+    const auto begin = zipf_cdf_.size() + block * kBlockSize;
+    const auto len = std::min(kBlockSize, bin_num_ - begin);
+
+    // reuse the remaining randomness for rejection sampling in the block (note that
+    // this only keeps about 53 - log2(weight_sum_ / block weights) bits)
+    const auto max_weight = GetWeight(begin);
+    auto r = std::clamp((target - low) / (*it - low), 0.0, kMaxUnitDouble);
+    while (true) {
+      const auto scaled = r * static_cast<double>(len);
+      const auto offset = std::min(static_cast<size_t>(scaled), len - 1);
+      const auto frac = scaled - static_cast<double>(offset);
+      const auto accept_prob = GetWeight(begin + offset) / max_weight;
+      if (frac < accept_prob) return min_ + static_cast<IntType>(begin + offset);
+      r = (frac - accept_prob) / (1.0 - accept_prob);
+    }
+  }
+
   /**
    * @brief Compute CDF values for this Zipf distribution.
+   *
+   * @param thread_num The number of threads for computing a CDF.
    */
-  void UpdateCDF();
+  void UpdateCDF(  //
+      size_t thread_num);
+
+  /**
+   * @brief Set CDF values in a given storage.
+   *
+   * @param storage A storage of CDF values.
+   * @param cdf CDF values of head bins and tail blocks.
+   */
+  void SetCDF(  //
+      std::shared_ptr<const void> storage,
+      const double *cdf);
+
+  /**
+   * @param cache_dir A directory for caching CDF files.
+   * @return The path of a cache file for this distribution.
+   */
+  [[nodiscard]] auto GetCachePath(                   //
+      const std::filesystem::path &cache_dir) const  //
+      -> std::filesystem::path;
+
+  /**
+   * @brief Map a cached CDF file if it exists.
+   *
+   * @param path The path of a cache file.
+   * @retval true if this distribution uses the cached CDF.
+   * @retval false otherwise.
+   */
+  auto LoadCDF(                           //
+      const std::filesystem::path &path)  //
+      -> bool;
+
+  /**
+   * @brief Store the CDF values into a cache file.
+   *
+   * @param path The path of a cache file.
+   */
+  void StoreCDF(  //
+      const std::filesystem::path &path) const;
 
   /*############################################################################
    * Static assertions
@@ -163,8 +307,26 @@ class ZipfDistribution
   /// @brief A skew parameter (zero means uniform distribution).
   double alpha_{0.0};
 
-  /// @brief A cumulative distribution function according to Zipf's law.
-  std::vector<double> zipf_cdf_{};
+  /// @brief The number of bins in this Zipf distribution.
+  size_t bin_num_{1};
+
+  /// @brief The sum of the unnormalized probabilities of all the bins.
+  double weight_sum_{1.0};
+
+  /// @brief The normalized probability of the first bin.
+  double base_prob_{1.0};
+
+  /// @brief A storage of CDF values shared by copied instances.
+  std::shared_ptr<const void> storage_{};
+
+  /// @brief The storage of CDF values if this class has allocated it.
+  std::vector<double> *cdf_vec_{nullptr};
+
+  /// @brief Unnormalized cumulative weights of head bins.
+  std::span<const double> zipf_cdf_{};
+
+  /// @brief Unnormalized cumulative weights at the end of each tail block.
+  std::span<const double> block_cdf_{};
 };
 
 /**
@@ -233,6 +395,24 @@ class ApproxZipfDistribution
     return GetHarmonicNum(id + 1) / (c_ / 2.0);  // NOLINT
   }
 
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Extend the range of this distribution to a given maximum value.
+   *
+   * This function continues the approximation of the normalization constant
+   * from the last position, so it takes amortized O(`new_max` - `max`) time
+   * in addition to updating exact CDF values of a constant number of bins.
+   *
+   * @param new_max A new maximum value.
+   * @throw std::runtime_error if the given value is less than the maximum.
+   * @note This function is not thread-safe with sampling.
+   */
+  void ExtendRange(  //
+      IntType new_max);
+
   /*############################################################################
    * Public utility operators
    *##########################################################################*/
@@ -247,13 +427,25 @@ class ApproxZipfDistribution
       RandEngine &g) const  //
       -> IntType
   {
-    // NOLINTBEGIN
-    const auto p = _uniform_dist(g);
-    const auto bin =
-        pow_ == 0 ? (-3.0 + std::sqrt(9.0 - 4.0 * (2.0 - std::exp(c_ * p - 1.0)))) / 2.0 + kBase
-                  : std::pow((c_ * pow_ * p - pow_ + 2.0) / 2.0, 1.0 / pow_) - 1.0 + base_;
-    // NOLINTEND
-    return min_ + static_cast<IntType>(bin);
+    return GetID(_uniform_dist(g));
+  }
+
+  /**
+   * @brief Fill a given buffer with random values according to Zipf's law.
+   *
+   * This function generates uniform random values in batches and then converts
+   * them into IDs by a branch-free loop, which compilers can vectorize.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    FillWith(out, g, [this](const double p) { return GetID(p); });
   }
 
   /**
@@ -313,6 +505,33 @@ class ApproxZipfDistribution
    */
   void UpdateCDF();
 
+  /**
+   * @brief Accumulate approximate weights of bins until the maximum value.
+   */
+  void AccumulateApproxWeights();
+
+  /**
+   * @brief Compute exact CDF values of head bins by using the sum of weights.
+   */
+  void UpdateHeadCDF();
+
+  /**
+   * @param p A uniform random value in [0, 1).
+   * @return The ID corresponding to the given probability.
+   */
+  [[nodiscard]] auto
+  GetID(                     //
+      const double p) const  //
+      -> IntType
+  {
+    // NOLINTBEGIN
+    const auto bin =
+        pow_ == 0 ? (-3.0 + std::sqrt(9.0 - 4.0 * (2.0 - std::exp(c_ * p - 1.0)))) / 2.0 + kBase
+                  : std::pow((c_ * pow_ * p - pow_ + 2.0) / 2.0, 1.0 / pow_) - 1.0 + base_;
+    // NOLINTEND
+    return min_ + static_cast<IntType>(bin);
+  }
+
   /**
    * @param n The number of partial elements in the p-serires.
    * @return An approximate partial sum of the p-series.
@@ -367,11 +586,180 @@ class ApproxZipfDistribution
   /// @brief A cumulative distribution function according to Zipf's law.
   std::array<double, kExactBinNum> zipf_cdf_{};
 
+  /// @brief The approximate sum of the unnormalized probabilities.
+  double weight_sum_{1.0};
+
+  /// @brief The next position for approximating the sum of weights.
+  IntType next_bin_{1};
+
   static thread_local inline auto _uniform_dist =
       std::uniform_real_distribution<double>{0.0, kMaxP};
   // NOLINTEND
 };
 
+/**
+ * @brief A class to generate random values according to Zipf's law in O(1).
+ *
+ * This class uses Vose's alias method, so each sample needs only one random
+ * value and one comparison.
+ *
+ * @tparam IntType A class of generated random values.
+ */
+template <class IntType = size_t>
+class AliasZipfDistribution
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct an empty distribution.
+   *
+   * This always returns zero.
+   */
+  AliasZipfDistribution();
+
+  /**
+   * @brief Construct a new Zipf distribution with given parameters.
+   *
+   * This distribution will generate random values within [`min`, `max`]
+   * according to Zipf's law with a skew paramter `alpha`.
+   *
+   * @param min The minimum value to be generated.
+   * @param max The maximum value to be generated.
+   * @param alpha A skew parameter (zero means uniform distribution).
+   */
+  AliasZipfDistribution(  //
+      IntType min,
+      IntType max,
+      double alpha);
+
+  AliasZipfDistribution(const AliasZipfDistribution &) = default;
+  AliasZipfDistribution(AliasZipfDistribution &&) noexcept = default;
+
+  auto operator=(const AliasZipfDistribution &obj) -> AliasZipfDistribution & = default;
+  auto operator=(AliasZipfDistribution &&) noexcept -> AliasZipfDistribution & = default;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~AliasZipfDistribution() = default;
+
+  /*############################################################################
+   * Public utility operators
+   *##########################################################################*/
+
+  /**
+   * @param g A random value generator.
+   * @return A random value according to Zipf's law.
+   */
+  template <class RandEngine>
+  [[nodiscard]] auto
+  operator()(               //
+      RandEngine &g) const  //
+      -> IntType
+  {
+    return GetID(_uniform_dist(g));
+  }
+
+  /**
+   * @brief Fill a given buffer with random values according to Zipf's law.
+   *
+   * @param out An output buffer.
+   * @param g A random value generator.
+   */
+  template <class RandEngine>
+  void
+  Fill(  //
+      std::span<IntType> out,
+      RandEngine &g) const
+  {
+    FillWith(out, g, [this](const double p) { return GetID(p); });
+  }
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The maximum value of random probabilities.
+  static constexpr double kMaxP = 0.9999999999999999;
+
+  /*############################################################################
+   * Internal structs
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing bins in an alias table.
+   *
+   */
+  struct Bin {
+    /// @brief The probability of selecting this bin instead of its alias.
+    double prob{1.0};
+
+    /// @brief The offset of an alias bin.
+    size_t alias{0};
+  };
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Build an alias table for this Zipf distribution.
+   */
+  void UpdateAliasTable();
+
+  /**
+   * @param p A uniform random value in [0, 1).
+   * @return The ID corresponding to the given probability.
+   */
+  [[nodiscard]] auto
+  GetID(                     //
+      const double p) const  //
+      -> IntType
+  {
+    // use the integral part as a bin and the fractional part as a probability
+    const auto pos = p * static_cast<double>(bins_.size());
+    const auto id = static_cast<size_t>(pos);
+    const auto &bin = bins_[id];
+    const auto offset = pos - static_cast<double>(id) < bin.prob ? id : bin.alias;
+    return min_ + static_cast<IntType>(offset);
+  }
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of integer types.
+  static_assert(std::is_same_v<IntType, uint32_t>     //
+                || std::is_same_v<IntType, uint64_t>  //
+                || std::is_same_v<IntType, int32_t>   //
+                || std::is_same_v<IntType, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The minimum value to be generated.
+  IntType min_{0};
+
+  /// @brief The maximum value to be generated.
+  IntType max_{0};
+
+  /// @brief A skew parameter (zero means uniform distribution).
+  double alpha_{0.0};
+
+  /// @brief An alias table according to Zipf's law.
+  std::vector<Bin> bins_{};
+
+  // NOLINTNEXTLINE
+  static thread_local inline auto _uniform_dist =
+      std::uniform_real_distribution<double>{0.0, kMaxP};
+};
+
 }  // namespace dbgroup::random
 
 #endif  // CPP_UTILITY_DBGROUP_RANDOM_ZIPF_HPP_
@@ -27,6 +27,9 @@ namespace dbgroup::thread::component
 /**
  * @brief A class to represent epochs for epoch-based garbage collection.
  *
+ * Guards and sessions in the same thread share an instance, so entering and
+ * leaving epochs can be nested. An instance keeps the outermost epoch until all
+ * of them leave.
  */
 class Epoch
 {
@@ -90,12 +93,24 @@ class Epoch
   /**
    * @brief Keep a current epoch value to protect new garbages.
    *
+   * @note If this thread has already entered an epoch, this function only
+   * increments the nesting depth and keeps the protected epoch.
    */
   void EnterEpoch();
 
+  /**
+   * @brief Protect a current epoch value instead of the entered one.
+   *
+   * @note If nested guards are alive, this function does nothing because they
+   * may still hold references protected by the entered epoch.
+   */
+  void RefreshEpoch();
+
   /**
    * @brief Release a protected epoch value to allow GC to delete old garbages.
    *
+   * @note This function releases the protected epoch only when the outermost
+   * entry leaves it.
    */
   void LeaveEpoch();
 
@@ -109,6 +124,9 @@ class Epoch
 
   /// @brief A snapshot to denote a protected epoch.
   std::atomic_size_t entered_{std::numeric_limits<size_t>::max()};
+
+  /// @brief The nesting depth of entered epochs (only used by an owner thread).
+  size_t depth_{0};
 };
 
 }  // namespace dbgroup::thread::component
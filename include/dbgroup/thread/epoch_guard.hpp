@@ -25,6 +25,9 @@ namespace dbgroup::thread
 /**
  * @brief A class to protect epochs based on the scoped locking pattern.
  *
+ * Guards can be nested in other guards and `EpochSession` in the same thread.
+ * In that case, a nested guard protects the epoch of the outermost one, and its
+ * destructor does not release the protection.
  */
 class EpochGuard
 {
@@ -22,12 +22,15 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 // local sources
 #include "dbgroup/thread/epoch_guard.hpp"
+#include "dbgroup/thread/epoch_session.hpp"
 #include "dbgroup/thread/id_manager.hpp"
 
 namespace dbgroup::thread
@@ -58,6 +61,37 @@ class EpochManager
   /// @brief The minimum value of epochs.
   static constexpr size_t kMinEpoch = 0;
 
+  /// @brief A thread ID for indicating no threads.
+  static constexpr size_t kNoThread = kMaxThreadNum;
+
+  /*############################################################################
+   * Public structs and type aliases
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing statistics of epoch management.
+   *
+   */
+  struct Stats {
+    /// @brief The difference between the current and minimum epochs.
+    size_t lag{0};
+
+    /// @brief The ID of a thread protecting the minimum epoch (`kNoThread` if none).
+    size_t oldest_thread_id{kNoThread};
+
+    /// @brief How long the oldest thread has protected the same epoch.
+    std::chrono::nanoseconds hold_time{0};
+
+    /// @brief The execution time of the last `ForwardGlobalEpoch` call.
+    std::chrono::nanoseconds tick_duration{0};
+
+    /// @brief The number of protected epochs in the last tick.
+    size_t protected_num{0};
+  };
+
+  /// @brief A callback function called when the epoch lag exceeds a threshold.
+  using LagCallback = std::function<void(const Stats &)>;
+
   /*############################################################################
    * Public constructors and assignment operators
    *##########################################################################*/
@@ -100,6 +134,17 @@ class EpochManager
   [[nodiscard]] auto GetMinEpoch() const  //
       -> size_t;
 
+  /**
+   * @brief Get statistics for monitoring stalled epochs.
+   *
+   * The statistics except for the lag are updated by `ForwardGlobalEpoch`, so
+   * they reflect the last tick.
+   *
+   * @return The current statistics.
+   */
+  [[nodiscard]] auto GetStats() const  //
+      -> Stats;
+
   /**
    * @brief Get protected epoch values as shared_ptr.
    *
@@ -121,13 +166,54 @@ class EpochManager
   [[nodiscard]] auto CreateEpochGuard()  //
       -> EpochGuard;
 
+  /**
+   * @brief Create a session instance to protect epochs over many operations.
+   *
+   * A session can protect a new epoch by `EpochSession::Refresh` without
+   * looking up thread local storages, so it is suitable for batch operations.
+   *
+   * @return A created epoch session.
+   */
+  [[nodiscard]] auto CreateEpochSession()  //
+      -> EpochSession;
+
   /**
    * @brief Increment a current epoch value.
    *
-   * This function also updates protected epoch values.
+   * This function also updates protected epoch values. Multiple threads can call
+   * this function concurrently, and each call waits for the other threads to
+   * finish their ticks.
    */
   void ForwardGlobalEpoch();
 
+  /**
+   * @brief Increment a current epoch value if no other threads are doing it.
+   *
+   * This function is useful for worker threads to advance epochs
+   * opportunistically without waiting for dedicated GC threads.
+   *
+   * @retval true if this thread has incremented the epoch.
+   * @retval false if another thread is incrementing the epoch.
+   */
+  auto TryForwardGlobalEpoch()  //
+      -> bool;
+
+  /**
+   * @brief Set a callback function to detect stalled epochs.
+   *
+   * The callback is called in `ForwardGlobalEpoch` when the epoch lag is larger
+   * than or equal to a given threshold. The callback receives the statistics of
+   * the tick and is called after the tick has finished, so it may advance epochs
+   * by itself. Note that this function is not thread-safe with
+   * `ForwardGlobalEpoch`.
+   *
+   * @param threshold The threshold of epoch lags.
+   * @param callback A callback function (an empty one disables callbacks).
+   */
+  void SetLagCallback(  //
+      size_t threshold,
+      LagCallback callback);
+
  private:
   /*############################################################################
    * Internal structs
@@ -143,6 +229,12 @@ class EpochManager
 
     /// @brief A flag for indicating the corresponding thread has exited.
     std::weak_ptr<size_t> heartbeat{};
+
+    /// @brief The protected epoch observed in the last tick.
+    size_t observed_epoch{std::numeric_limits<size_t>::max()};
+
+    /// @brief The time when the forwarder first observed the protected epoch.
+    std::chrono::steady_clock::time_point observed_at{};
   };
 
   /**
@@ -193,7 +285,7 @@ class EpochManager
      * @param node The head pointer of a linked list.
      * @return Protected epochs.
      */
-    [[nodiscard]] static constexpr auto
+    [[nodiscard]] static auto
     GetProtectedEpochs(  //
         const size_t epoch,
         ProtectedNode *node)  //
@@ -202,7 +294,7 @@ class EpochManager
       // go to the target node
       const auto upper_epoch = epoch & kUpperMask;
       while (node->upper_epoch_ > upper_epoch) {
-        node = node->next;
+        node = node->next.load(std::memory_order_acquire);
       }
 
       return node->epoch_lists_.at(epoch & kLowerMask);
@@ -223,7 +315,7 @@ class EpochManager
      *########################################################################*/
 
     /// @brief A pointer to the next node.
-    ProtectedNode *next{nullptr};  // NOLINT
+    std::atomic<ProtectedNode *> next{nullptr};  // NOLINT
 
    private:
     /*##########################################################################
@@ -251,6 +343,12 @@ class EpochManager
    * Internal utility functions
    *##########################################################################*/
 
+  /**
+   * @return The thread local epoch for this thread.
+   */
+  [[nodiscard]] auto GetTLSEpoch()  //
+      -> Epoch *;
+
   /**
    * @brief Collect epoch value for epoch-based protection.
    *
@@ -258,19 +356,34 @@ class EpochManager
    * computing.
    *
    * @param cur_epoch The current global epoch value.
+   * @param now The time when this tick started.
    * @param protected_epochs Protected epoch values.
    */
   void CollectProtectedEpochs(  //
       size_t cur_epoch,
+      std::chrono::steady_clock::time_point now,
       std::vector<size_t> &protected_epochs);
 
   /**
    * @brief Remove unprotected epoch nodes from a linked-list.
    *
+   * Removed nodes may be still traversed by other threads, so this function
+   * defers their deletion until the given epoch becomes unprotected.
+   *
    * @param protected_epochs Protected epoch values.
+   * @param next_epoch The next global epoch value.
    */
   void RemoveOutDatedLists(  //
-      std::vector<size_t> &protected_epochs);
+      std::vector<size_t> &protected_epochs,
+      size_t next_epoch);
+
+  /**
+   * @brief Delete removed nodes that no threads can refer to.
+   *
+   * @param min_epoch The minimum protected epoch value.
+   */
+  void DeleteRemovedNodes(  //
+      size_t min_epoch);
 
   /*############################################################################
    * Internal member variables
@@ -282,8 +395,32 @@ class EpochManager
   /// @brief The minimum protected ecpoch value.
   std::atomic_size_t min_epoch_{kInitialEpoch};
 
+  /// @brief A flag for indicating a thread is forwarding the global epoch.
+  std::atomic_bool is_ticking_{false};
+
   /// @brief The head pointer of a linked list of epochs.
-  ProtectedNode *protected_lists_{new ProtectedNode{kInitialEpoch, nullptr}};
+  std::atomic<ProtectedNode *> protected_lists_{new ProtectedNode{kInitialEpoch, nullptr}};
+
+  /// @brief Removed nodes with the epochs when they were removed.
+  std::vector<std::pair<size_t, ProtectedNode *>> removed_nodes_{};
+
+  /// @brief The ID of a thread protecting the minimum epoch.
+  std::atomic_size_t oldest_thread_id_{kNoThread};
+
+  /// @brief How long the oldest thread has protected the same epoch in nanoseconds.
+  std::atomic_int64_t hold_time_{0};
+
+  /// @brief The execution time of the last tick in nanoseconds.
+  std::atomic_int64_t tick_duration_{0};
+
+  /// @brief The number of protected epochs in the last tick.
+  std::atomic_size_t protected_num_{0};
+
+  /// @brief The threshold of epoch lags for calling a callback function.
+  size_t lag_threshold_{std::numeric_limits<size_t>::max()};
+
+  /// @brief A callback function for stalled epochs.
+  LagCallback lag_callback_{};
 
   /// @brief The array of epochs to use as thread local storages.
   TLSEpoch tls_fields_[kMaxThreadNum]{};
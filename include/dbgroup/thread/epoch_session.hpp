@@ -0,0 +1,144 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_THREAD_EPOCH_SESSION_HPP_
+#define CPP_UTILITY_DBGROUP_THREAD_EPOCH_SESSION_HPP_
+
+// C++ standard libraries
+#include <cstddef>
+
+// local sources
+#include "dbgroup/thread/component/epoch.hpp"
+
+namespace dbgroup::thread
+{
+/**
+ * @brief A class to protect epochs over multiple operations in a thread.
+ *
+ * An instance caches a thread local epoch, so it can protect a new epoch
+ * between operations without looking up thread IDs. Operations in a session
+ * may create and destroy `EpochGuard` instances because guards nested in a
+ * session keep the epoch of the session protected. Note that an instance must
+ * be used only by the thread that has created it.
+ */
+class EpochSession
+{
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Epoch = component::Epoch;
+
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  constexpr EpochSession() = default;
+
+  /**
+   * @brief Construct a new instance and protect a current epoch.
+   *
+   * @param epoch A reference to a target epoch.
+   */
+  explicit EpochSession(  //
+      Epoch *epoch);
+
+  /**
+   * @brief Construct a new instance.
+   *
+   * @param obj An rvalue reference.
+   */
+  constexpr EpochSession(  //
+      EpochSession &&obj) noexcept
+      : epoch_{obj.epoch_}
+  {
+    obj.epoch_ = nullptr;
+  }
+
+  /**
+   * @brief Construct a new instance.
+   *
+   * @param rhs An rvalue reference.
+   */
+  auto operator=(                   //
+      EpochSession &&rhs) noexcept  //
+      -> EpochSession &;
+
+  // delete the copy constructor/assignment
+  EpochSession(const EpochSession &) = delete;
+  auto operator=(const EpochSession &) -> EpochSession & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Destroy the instace and release a protected epoch.
+   *
+   */
+  ~EpochSession();
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @return The epoch value protected by this object.
+   */
+  [[nodiscard]] auto GetProtectedEpoch() const  //
+      -> size_t;
+
+  /**
+   * @return The difference between the current and protected epochs.
+   */
+  [[nodiscard]] auto GetLag() const  //
+      -> size_t;
+
+  /**
+   * @param max_lag The maximum allowable lag of epochs.
+   * @retval true if this session prevents garbage collection for too long.
+   * @retval false otherwise.
+   */
+  [[nodiscard]] auto IsStale(  //
+      size_t max_lag) const    //
+      -> bool;
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  /**
+   * @brief Protect the current epoch instead of the previous one.
+   *
+   * Callers must not retain any references obtained before refreshing. If
+   * other guards or sessions in this thread are alive, this function keeps the
+   * previous epoch protected.
+   */
+  void Refresh();
+
+ private:
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A reference to a target epoch.
+  Epoch *epoch_{nullptr};
+};
+
+}  // namespace dbgroup::thread
+
+#endif  // CPP_UTILITY_DBGROUP_THREAD_EPOCH_SESSION_HPP_
@@ -0,0 +1,219 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_THREAD_FLAT_COMBINER_HPP_
+#define CPP_UTILITY_DBGROUP_THREAD_FLAT_COMBINER_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+// local sources
+#include "dbgroup/thread/common.hpp"
+#include "dbgroup/thread/id_manager.hpp"
+
+namespace dbgroup::thread
+{
+/**
+ * @brief A class for executing operations on a shared object by flat combining.
+ *
+ * Each thread publishes its operation in a cache-line-padded slot indexed by
+ * its thread ID. A thread that acquires a combiner lock executes all the
+ * published operations in one pass, and the other threads only wait for their
+ * own slots to be cleared. Thus, a shared object stays in the cache of a
+ * combiner, and throughput does not collapse under high contention.
+ *
+ * @tparam T A class of shared objects (e.g., free lists and sequence
+ * allocators).
+ */
+template <class T>
+class alignas(kCashLineSize) FlatCombiner
+{
+ public:
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new instance.
+   *
+   * @param args Arguments for constructing a shared object.
+   */
+  template <class... Args>
+  explicit FlatCombiner(  //
+      Args &&...args)
+      : data_{std::forward<Args>(args)...}
+  {
+  }
+
+  FlatCombiner(const FlatCombiner &) = delete;
+  FlatCombiner(FlatCombiner &&) = delete;
+
+  auto operator=(const FlatCombiner &) -> FlatCombiner & = delete;
+  auto operator=(FlatCombiner &&) -> FlatCombiner & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~FlatCombiner() = default;
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Execute a given operation on the shared object exclusively.
+   *
+   * @tparam Func A class of operations that receive `T &`.
+   * @param fn An operation (must not throw exceptions).
+   * @return The return value of a given operation (must not be a reference).
+   * @note A given operation may be executed by another thread, so it must not
+   * depend on thread local storages.
+   */
+  template <class Func>
+  auto
+  Execute(  //
+      Func &&fn)  //
+      -> std::invoke_result_t<Func &, T &>
+  {
+    using Ret = std::invoke_result_t<Func &, T &>;
+    static_assert(!std::is_reference_v<Ret>);
+
+    if constexpr (std::is_void_v<Ret>) {
+      auto wrapper = [&fn](T &data) { fn(data); };
+      Publish(&Invoke<decltype(wrapper)>, &wrapper);
+    } else {
+      std::optional<Ret> ret{};
+      auto wrapper = [&fn, &ret](T &data) { ret.emplace(fn(data)); };
+      Publish(&Invoke<decltype(wrapper)>, &wrapper);
+      return std::move(*ret);
+    }
+  }
+
+ private:
+  /*############################################################################
+   * Internal types
+   *##########################################################################*/
+
+  /// @brief A type-erased operation on a shared object.
+  using Op = void (*)(T &, void *);
+
+  /**
+   * @brief A class for representing published operations of each thread.
+   *
+   */
+  struct alignas(kCashLineSize) Slot {
+    /// @brief A published operation (null if there is no pending one).
+    std::atomic<Op> op{nullptr};
+
+    /// @brief The context of a published operation.
+    void *ctx{nullptr};
+  };
+
+  /*############################################################################
+   * Internal utilities
+   *##########################################################################*/
+
+  /**
+   * @brief Call a given operation with a shared object.
+   *
+   * @tparam Func A class of operations.
+   * @param data A shared object.
+   * @param fn The address of an operation.
+   */
+  template <class Func>
+  static void
+  Invoke(  //
+      T &data,
+      void *fn)
+  {
+    (*static_cast<Func *>(fn))(data);
+  }
+
+  /**
+   * @brief Publish an operation and wait until some combiner executes it.
+   *
+   * @param op A type-erased operation.
+   * @param ctx The context of an operation.
+   */
+  void
+  Publish(  //
+      const Op op,
+      void *ctx)
+  {
+    const auto id = IDManager::GetThreadID();
+    for (auto num = slot_num_.load(kRelaxed); num <= id;) {
+      if (slot_num_.compare_exchange_weak(num, id + 1, kRelaxed, kRelaxed)) break;
+    }
+
+    auto &slot = slots_[id];
+    slot.ctx = ctx;
+    slot.op.store(op, kRelease);
+    while (slot.op.load(kAcquire) != nullptr) {
+      if (combining_.load(kRelaxed) || combining_.exchange(true, kAcquire)) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      Combine();
+      combining_.store(false, kRelease);
+    }
+  }
+
+  /**
+   * @brief Execute all the published operations.
+   *
+   * @note A calling thread must hold the combiner lock.
+   */
+  void
+  Combine()
+  {
+    const auto num = slot_num_.load(kAcquire);
+    for (size_t i = 0; i < num; ++i) {
+      auto &slot = slots_[i];
+      const auto op = slot.op.load(kAcquire);
+      if (op == nullptr) continue;
+
+      op(data_, slot.ctx);
+      slot.op.store(nullptr, kRelease);
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief A flag for indicating a thread is combining operations.
+  std::atomic_bool combining_{false};
+
+  /// @brief The upper bound of thread IDs that have published operations.
+  std::atomic_size_t slot_num_{0};
+
+  /// @brief A shared object.
+  T data_{};
+
+  /// @brief Slots of published operations for each thread.
+  Slot slots_[kMaxThreadNum]{};
+};
+
+}  // namespace dbgroup::thread
+
+#endif  // CPP_UTILITY_DBGROUP_THREAD_FLAT_COMBINER_HPP_
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_THREAD_SHARDED_COUNTER_HPP_
+#define CPP_UTILITY_DBGROUP_THREAD_SHARDED_COUNTER_HPP_
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/thread/common.hpp"
+
+namespace dbgroup::thread
+{
+/**
+ * @brief A class for representing scalable counters sharded by thread IDs.
+ *
+ * Each thread updates its own cache-line-padded cell with relaxed stores, and
+ * the cell is flushed into a global value when its absolute value reaches a
+ * given batch size. Thus, `GetApproxValue` only reads the global value, and
+ * `GetValue` sums up all the cells.
+ *
+ * @tparam T A class of counter values.
+ */
+template <class T = uint64_t>
+class alignas(kCashLineSize) ShardedCounter
+{
+ public:
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The default threshold for flushing thread local values.
+  static constexpr T kDefaultBatchSize = 1024;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new instance.
+   *
+   * @param batch_size A threshold for flushing thread local values into the
+   * global one (zero means flushing them every time).
+   */
+  explicit ShardedCounter(  //
+      T batch_size = kDefaultBatchSize);
+
+  ShardedCounter(const ShardedCounter &) = delete;
+  ShardedCounter(ShardedCounter &&) = delete;
+
+  auto operator=(const ShardedCounter &) -> ShardedCounter & = delete;
+  auto operator=(ShardedCounter &&) -> ShardedCounter & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  ~ShardedCounter() = default;
+
+  /*############################################################################
+   * Public getters
+   *##########################################################################*/
+
+  /**
+   * @brief Get the sum of the global value and all the thread local values.
+   *
+   * @return The counter value.
+   * @note The returned value is exact if there are no concurrent updates.
+   */
+  [[nodiscard]] auto GetValue() const  //
+      -> T;
+
+  /**
+   * @brief Get the global value without scanning thread local values.
+   *
+   * @return The counter value with an error less than `batch_size` times the
+   * number of updating threads.
+   */
+  [[nodiscard]] auto GetApproxValue() const  //
+      -> T;
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Add a given value to this counter.
+   *
+   * @param val A value to be added.
+   */
+  void Add(  //
+      T val = 1);
+
+  /**
+   * @brief Subtract a given value from this counter.
+   *
+   * @param val A value to be subtracted.
+   */
+  void
+  Sub(  //
+      const T val = 1)
+  {
+    Add(-val);
+  }
+
+ private:
+  /*############################################################################
+   * Internal structs
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing thread local counters.
+   *
+   */
+  struct alignas(kCashLineSize) Cell {
+    /// @brief A value that has not been flushed.
+    std::atomic<T> val{0};
+  };
+
+  /*############################################################################
+   * Static assertions
+   *##########################################################################*/
+
+  // Assume the use of 64-bit integer types.
+  static_assert(std::is_same_v<T, uint64_t> || std::is_same_v<T, int64_t>);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief The sum of flushed values.
+  std::atomic<T> global_{0};
+
+  /// @brief A threshold for flushing thread local values.
+  T batch_size_{kDefaultBatchSize};
+
+  /// @brief The array of thread local values.
+  Cell cells_[kMaxThreadNum]{};
+};
+
+/// @brief A sharded counter that allows negative values.
+using ShardedGauge = ShardedCounter<int64_t>;
+
+}  // namespace dbgroup::thread
+
+#endif  // CPP_UTILITY_DBGROUP_THREAD_SHARDED_COUNTER_HPP_
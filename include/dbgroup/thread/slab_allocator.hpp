@@ -0,0 +1,246 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CPP_UTILITY_DBGROUP_THREAD_SLAB_ALLOCATOR_HPP_
+#define CPP_UTILITY_DBGROUP_THREAD_SLAB_ALLOCATOR_HPP_
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// local sources
+#include "dbgroup/thread/common.hpp"
+#include "dbgroup/thread/epoch_manager.hpp"
+
+namespace dbgroup::thread
+{
+/**
+ * @brief A class for representing size-class slab allocators.
+ *
+ * This allocator caches free blocks for each thread, and the caches are indexed
+ * by `IDManager::GetThreadID`. Retired blocks are kept in thread local lists
+ * and reused when the minimum protected epoch passes their retired epochs.
+ */
+class SlabAllocator
+{
+ public:
+  /*############################################################################
+   * Public constants
+   *##########################################################################*/
+
+  /// @brief The minimum size of blocks.
+  static constexpr size_t kMinBlockSize = 16;
+
+  /// @brief The maximum size of blocks managed in slabs.
+  static constexpr size_t kMaxBlockSize = 4096;
+
+  /// @brief The size of each slab.
+  static constexpr size_t kSlabSize = 64 * 1024;
+
+  /// @brief The maximum number of free blocks in each thread local cache.
+  static constexpr size_t kCacheCapacity = 512;
+
+  /*############################################################################
+   * Public constructors and assignment operators
+   *##########################################################################*/
+
+  /**
+   * @brief Construct a new instance.
+   *
+   * @param epoch_manager An epoch manager for reusing retired blocks.
+   */
+  explicit SlabAllocator(  //
+      const EpochManager *epoch_manager = nullptr);
+
+  SlabAllocator(const SlabAllocator &) = delete;
+  SlabAllocator(SlabAllocator &&) = delete;
+
+  auto operator=(const SlabAllocator &) -> SlabAllocator & = delete;
+  auto operator=(SlabAllocator &&) -> SlabAllocator & = delete;
+
+  /*############################################################################
+   * Public destructors
+   *##########################################################################*/
+
+  /**
+   * @brief Destroy the instance and release all the slabs.
+   *
+   */
+  ~SlabAllocator();
+
+  /*############################################################################
+   * Public APIs
+   *##########################################################################*/
+
+  /**
+   * @brief Allocate a memory block.
+   *
+   * @param size The size of a memory block.
+   * @return The address of an allocated block.
+   * @note Blocks larger than `kMaxBlockSize` are allocated by `operator new`.
+   */
+  [[nodiscard]] auto Allocate(  //
+      size_t size)              //
+      -> void *;
+
+  /**
+   * @brief Release a memory block to reuse it immediately.
+   *
+   * @param ptr The address of a memory block.
+   * @param size The size of the memory block.
+   */
+  void Deallocate(  //
+      void *ptr,
+      size_t size);
+
+  /**
+   * @brief Release a memory block after all the current epochs are unprotected.
+   *
+   * @param ptr The address of a memory block.
+   * @param size The size of the memory block.
+   * @note This function does not call any destructors. If this allocator does
+   * not have an epoch manager, this function is the same as `Deallocate`.
+   */
+  void Retire(  //
+      void *ptr,
+      size_t size);
+
+ private:
+  /*############################################################################
+   * Internal constants
+   *##########################################################################*/
+
+  /// @brief The number of size classes.
+  static constexpr size_t kClassNum = 9;
+
+  /// @brief The size class for blocks allocated by `operator new`.
+  static constexpr size_t kLargeClass = kClassNum;
+
+  /*############################################################################
+   * Internal structs
+   *##########################################################################*/
+
+  /**
+   * @brief A class for representing free or retired blocks.
+   *
+   */
+  struct Block {
+    /// @brief The next block in the same list.
+    Block *next{nullptr};
+
+    union {
+      /// @brief The epoch when this block was retired.
+      size_t epoch{0};
+
+      /// @brief The next list of blocks in a central pool.
+      Block *next_list;
+    };
+  };
+
+  /**
+   * @brief A class for representing singly linked lists of blocks.
+   *
+   */
+  struct BlockList {
+    /// @brief The head block.
+    Block *head{nullptr};
+
+    /// @brief The tail block.
+    Block *tail{nullptr};
+
+    /// @brief The number of blocks in this list.
+    size_t size{0};
+  };
+
+  /**
+   * @brief A class for representing thread local caches.
+   *
+   */
+  struct alignas(kCashLineSize) TLSCache {
+    /// @brief Free blocks for each size class.
+    std::array<BlockList, kClassNum> free_lists{};
+
+    /// @brief Retired blocks for each size class (sorted by epochs).
+    std::array<BlockList, kClassNum + 1> retired_lists{};
+  };
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  /**
+   * @param size The size of a memory block.
+   * @return The size class of the given block.
+   */
+  [[nodiscard]] static auto GetSizeClass(  //
+      size_t size)                         //
+      -> size_t;
+
+  /**
+   * @brief Move retired blocks whose epochs are not protected to a free list.
+   *
+   * @param cache A thread local cache.
+   * @param cls A target size class.
+   */
+  void Reclaim(  //
+      TLSCache &cache,
+      size_t cls);
+
+  /**
+   * @brief Fill a free list with reclaimed, pooled, or new blocks.
+   *
+   * @param cache A thread local cache.
+   * @param cls A target size class.
+   */
+  void Refill(  //
+      TLSCache &cache,
+      size_t cls);
+
+  /**
+   * @brief Move half of a free list into the central pool.
+   *
+   * @param cache A thread local cache.
+   * @param cls A target size class.
+   */
+  void Spill(  //
+      TLSCache &cache,
+      size_t cls);
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  /// @brief An epoch manager for reusing retired blocks.
+  const EpochManager *epoch_manager_{nullptr};
+
+  /// @brief A mutex for the central pool and slabs.
+  std::mutex mtx_{};
+
+  /// @brief Lists of free blocks shared by threads.
+  std::array<Block *, kClassNum> central_pool_{};
+
+  /// @brief Allocated slabs.
+  std::vector<void *> slabs_{};
+
+  /// @brief The array of thread local caches.
+  TLSCache caches_[kMaxThreadNum]{};
+};
+
+}  // namespace dbgroup::thread
+
+#endif  // CPP_UTILITY_DBGROUP_THREAD_SLAB_ALLOCATOR_HPP_
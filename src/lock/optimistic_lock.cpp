@@ -19,84 +19,49 @@
 
 // C++ standard libraries
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <thread>
 
 // local sources
 #include "dbgroup/lock/common.hpp"
 
-namespace
-{
-/*##############################################################################
- * Local constants
- *############################################################################*/
-
-/// @brief A lock state representing no locks.
-constexpr uint64_t kNoLocks = 0b000UL;
-
-/// @brief A lock state representing a shared lock.
-constexpr uint64_t kSLock = 1UL << 32UL;
-
-/// @brief A lock state representing a shared-with-intent-exclusive lock.
-constexpr uint64_t kSIXLock = 1UL << 62UL;
-
-/// @brief A lock state representing an exclusive lock.
-constexpr uint64_t kXLock = 1UL << 63UL;
-
-/// @brief A bit mask for extracting version values.
-constexpr uint64_t kVersionMask = kSLock - 1UL;
-
-/// @brief A bit mask for extracting an SIX/X-lock state and version values.
-constexpr uint64_t kAllLockMask = ~0UL ^ kVersionMask;
-
-/// @brief A bit mask for extracting X and SIX states.
-constexpr uint64_t kXMask = kXLock | kSIXLock;
-
-/// @brief A bit mask for extracting an S-lock state.
-constexpr uint64_t kSMask = kAllLockMask ^ kXMask;
-
-/// @brief A bit mask for extracting an S/SIX-lock state.
-constexpr uint64_t kSAndSIXMask = kSMask | kSIXLock;
-
-/// @brief A bit mask for extracting an X-lock state and version values.
-constexpr uint64_t kXAndVersionMask = kXLock | kVersionMask;
-
-}  // namespace
-
 namespace dbgroup::lock
 {
 /*##############################################################################
  * Optimistic read APIs
  *############################################################################*/
 
+template <class Word>
 auto
-OptimisticLock::GetVersion()  //
+BasicOptimisticLock<Word>::GetVersionWithSpin()  //
     -> OptGuard
 {
-  uint64_t cur{};
+  Word cur{};
   while (true) {
     cur = lock_.load(kAcquire);
     if ((cur & kXLock) == kNoLocks) break;
     std::this_thread::yield();
   }
 
-  return OptGuard{this, static_cast<uint32_t>(cur)};
+  return OptGuard{this, static_cast<Version>(cur)};
 }
 
+template <class Word>
 auto
-OptimisticLock::PrepareRead()  //
+BasicOptimisticLock<Word>::PrepareRead()  //
     -> CompositeGuard
 {
-  uint64_t cur{};
+  Word cur{};
   for (size_t i = 0; true; ++i) {
     cur = lock_.load(kAcquire);
-    if ((cur & kXLock) == kNoLocks) return CompositeGuard{this, static_cast<uint32_t>(cur)};
+    if ((cur & kXLock) == kNoLocks) return CompositeGuard{this, static_cast<Version>(cur)};
     if (i >= kRetryNum) break;
     CPP_UTILITY_SPINLOCK_HINT
   }
 
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur) -> bool {
+      [](std::atomic<Word> *lock, Word *cur) -> bool {
         *cur = lock->load(kAcquire);
         return (*cur & kXLock) == kNoLocks
                && ((*cur & kAllLockMask)
@@ -104,7 +69,7 @@ OptimisticLock::PrepareRead()  //
       },
       &lock_, &cur);
 
-  return (cur & kAllLockMask) ? CompositeGuard{this, static_cast<uint32_t>(cur)}
+  return (cur & kAllLockMask) ? CompositeGuard{this, static_cast<Version>(cur)}
                               : CompositeGuard{this};
 }
 
@@ -112,26 +77,29 @@ OptimisticLock::PrepareRead()  //
  * Pessimistic lock APIs
  *############################################################################*/
 
+template <class Word>
 auto
-OptimisticLock::LockS()  //
+BasicOptimisticLock<Word>::LockSWithSpin()  //
     -> SGuard
 {
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock) -> bool {
+      [](std::atomic<Word> *lock) -> bool {
         auto cur = lock->load(kRelaxed);
         return (cur & kXLock) == kNoLocks
+               && (cur & kSMask) != kSMask  // wait if the counter is full
                && lock->compare_exchange_weak(cur, cur + kSLock, kAcquire, kRelaxed);
       },
       &lock_);
   return SGuard{this};
 }
 
+template <class Word>
 auto
-OptimisticLock::LockSIX()  //
+BasicOptimisticLock<Word>::LockSIXWithSpin()  //
     -> SIXGuard
 {
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock) -> bool {
+      [](std::atomic<Word> *lock) -> bool {
         auto cur = lock->load(kRelaxed);
         return (cur & kXMask) == kNoLocks
                && lock->compare_exchange_weak(cur, cur | kSIXLock, kAcquire, kRelaxed);
@@ -140,161 +108,59 @@ OptimisticLock::LockSIX()  //
   return SIXGuard{this};
 }
 
+template <class Word>
 auto
-OptimisticLock::LockX()  //
+BasicOptimisticLock<Word>::LockXWithSpin()  //
     -> XGuard
 {
-  uint64_t cur{};
+  Word cur{};
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur) -> bool {
+      [](std::atomic<Word> *lock, Word *cur) -> bool {
         *cur = lock->load(kRelaxed);
         return (*cur & kAllLockMask) == kNoLocks
                && lock->compare_exchange_weak(*cur, *cur | kXLock, kAcquire, kRelaxed);
       },
       &lock_, &cur);
 
-  return XGuard{this, static_cast<uint32_t>(cur)};
-}
-
-/*##############################################################################
- * Internal APIs
- *############################################################################*/
-
-void
-OptimisticLock::UnlockS()
-{
-  lock_.fetch_sub(kSLock, kRelaxed);
-}
-
-void
-OptimisticLock::UnlockSIX()
-{
-  lock_.fetch_xor(kSIXLock, kRelaxed);
-}
-
-void
-OptimisticLock::UnlockX(  //
-    const uint64_t ver)
-{
-  lock_.store(ver, kRelease);
-}
-
-/*##############################################################################
- * Shared lock guards
- *############################################################################*/
-
-auto
-OptimisticLock::SGuard::operator=(  //
-    SGuard &&rhs) noexcept          //
-    -> SGuard &
-{
-  if (dest_) {
-    dest_->UnlockS();
-  }
-  dest_ = rhs.dest_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-OptimisticLock::SGuard::~SGuard()
-{
-  if (dest_) {
-    dest_->UnlockS();
-  }
+  return XGuard{this, static_cast<Version>(cur)};
 }
 
 /*##############################################################################
  * Shared-with-intent-exclusive lock guards
  *############################################################################*/
 
+template <class Word>
 auto
-OptimisticLock::SIXGuard::operator=(  //
-    SIXGuard &&rhs) noexcept          //
-    -> SIXGuard &
-{
-  if (dest_) {
-    dest_->UnlockSIX();
-  }
-  dest_ = rhs.dest_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-OptimisticLock::SIXGuard::~SIXGuard()
-{
-  if (dest_) {
-    dest_->UnlockSIX();
-  }
-}
-
-auto
-OptimisticLock::SIXGuard::UpgradeToX()  //
+BasicOptimisticLock<Word>::SIXGuard::UpgradeToX()  //
     -> XGuard
 {
   if (dest_ == nullptr) return XGuard{};
   auto *dest = dest_;
   dest_ = nullptr;  // release the ownership
 
-  uint64_t cur{};
+  Word cur{};
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur) -> bool {
+      [](std::atomic<Word> *lock, Word *cur) -> bool {
         *cur = lock->load(kRelaxed);
         return (*cur & kSMask) == kNoLocks
                && lock->compare_exchange_weak(*cur, *cur ^ kXMask, kAcquire, kRelaxed);
       },
       &(dest->lock_), &cur);
 
-  return XGuard{dest, static_cast<uint32_t>(cur)};
-}
-
-/*##############################################################################
- * Exclusive lock guards
- *############################################################################*/
-
-auto
-OptimisticLock::XGuard::operator=(  //
-    XGuard &&rhs) noexcept          //
-    -> XGuard &
-{
-  if (dest_) {
-    dest_->UnlockX(new_ver_);
-  }
-  dest_ = rhs.dest_;
-  old_ver_ = rhs.old_ver_;
-  new_ver_ = rhs.new_ver_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-OptimisticLock::XGuard::~XGuard()
-{
-  if (dest_) {
-    dest_->UnlockX(new_ver_);
-  }
-}
-
-auto
-OptimisticLock::XGuard::DowngradeToSIX()  //
-    -> SIXGuard
-{
-  if (dest_ == nullptr) return SIXGuard{};
-  auto *dest = dest_;
-  dest_ = nullptr;  // release the ownership
-
-  dest->lock_.store(new_ver_ | kSIXLock, kRelease);
-  return SIXGuard{dest};
+  return XGuard{dest, static_cast<Version>(cur)};
 }
 
 /*##############################################################################
  * Optimistic lock guards
  *############################################################################*/
 
+template <class Word>
 auto
-OptimisticLock::OptGuard::VerifyVersion()  //
+BasicOptimisticLock<Word>::OptGuard::VerifyVersionWithSpin()  //
     -> bool
 {
   auto expected = ver_;
-  uint64_t cur{};
+  Word cur{};
   while (true) {
     std::atomic_thread_fence(kRelease);
     cur = dest_->lock_.load(kRelaxed);
@@ -302,36 +168,39 @@ OptimisticLock::OptGuard::VerifyVersion()  //
     std::this_thread::yield();
   }
 
-  ver_ = static_cast<uint32_t>(cur & kVersionMask);
+  ver_ = static_cast<Version>(cur & kVersionMask);
   return ver_ == expected;
 }
 
+template <class Word>
 auto
-OptimisticLock::OptGuard::TryLockS()  //
+BasicOptimisticLock<Word>::OptGuard::TryLockS()  //
     -> SGuard
 {
-  uint64_t cur{};
+  Word cur{};
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur, uint64_t ver) -> bool {
+      [](std::atomic<Word> *lock, Word *cur, Word ver) -> bool {
         *cur = lock->load(kAcquire);
         return (*cur & kXLock) == kNoLocks
+               && (*cur & kSMask) != kSMask  // wait if the counter is full
                && ((*cur & kVersionMask) != ver
                    || lock->compare_exchange_weak(*cur, *cur + kSLock, kRelaxed, kRelaxed));
       },
       &(dest_->lock_), &cur, ver_);
 
   auto expected = ver_;
-  ver_ = static_cast<uint32_t>(cur & kVersionMask);
+  ver_ = static_cast<Version>(cur & kVersionMask);
   return (ver_ == expected) ? SGuard{dest_} : SGuard{};
 }
 
+template <class Word>
 auto
-OptimisticLock::OptGuard::TryLockSIX()  //
+BasicOptimisticLock<Word>::OptGuard::TryLockSIX()  //
     -> SIXGuard
 {
-  uint64_t cur{};
+  Word cur{};
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur, uint64_t ver) -> bool {
+      [](std::atomic<Word> *lock, Word *cur, Word ver) -> bool {
         *cur = lock->load(kAcquire);
         return (*cur & kXMask) == kNoLocks
                && ((*cur & kVersionMask) != ver
@@ -340,17 +209,18 @@ OptimisticLock::OptGuard::TryLockSIX()  //
       &(dest_->lock_), &cur, ver_);
 
   auto expected = ver_;
-  ver_ = static_cast<uint32_t>(cur & kVersionMask);
+  ver_ = static_cast<Version>(cur & kVersionMask);
   return (ver_ == expected) ? SIXGuard{dest_} : SIXGuard{};
 }
 
+template <class Word>
 auto
-OptimisticLock::OptGuard::TryLockX()  //
+BasicOptimisticLock<Word>::OptGuard::TryLockX()  //
     -> XGuard
 {
-  uint64_t cur{};
+  Word cur{};
   SpinWithBackoff(
-      [](std::atomic_uint64_t *lock, uint64_t *cur, uint64_t ver) -> bool {
+      [](std::atomic<Word> *lock, Word *cur, Word ver) -> bool {
         *cur = lock->load(kAcquire);
         return (*cur & kAllLockMask) == kNoLocks
                && ((*cur & kXAndVersionMask) != ver
@@ -359,7 +229,7 @@ OptimisticLock::OptGuard::TryLockX()  //
       &(dest_->lock_), &cur, ver_);
 
   auto expected = ver_;
-  ver_ = static_cast<uint32_t>(cur & kVersionMask);
+  ver_ = static_cast<Version>(cur & kVersionMask);
   return (ver_ == expected) ? XGuard{dest_, ver_} : XGuard{};
 }
 
@@ -367,36 +237,15 @@ OptimisticLock::OptGuard::TryLockX()  //
  * Composite (optimistic or shared) lock guards
  *############################################################################*/
 
+template <class Word>
 auto
-OptimisticLock::CompositeGuard::operator=(  //
-    CompositeGuard &&rhs) noexcept          //
-    -> CompositeGuard &
-{
-  if (has_lock_) {
-    dest_->UnlockS();
-  }
-  dest_ = rhs.dest_;
-  ver_ = rhs.ver_;
-  has_lock_ = rhs.has_lock_;
-  rhs.has_lock_ = false;
-  return *this;
-}
-
-OptimisticLock::CompositeGuard::~CompositeGuard()
-{
-  if (has_lock_) {
-    dest_->UnlockS();
-  }
-}
-
-auto
-OptimisticLock::CompositeGuard::VerifyVersion()  //
+BasicOptimisticLock<Word>::CompositeGuard::VerifyVersion()  //
     -> bool
 {
   if (has_lock_) return true;
 
   auto expected = ver_;
-  uint64_t cur{};
+  Word cur{};
   while (true) {
     std::atomic_thread_fence(kRelease);
     cur = dest_->lock_.load(kRelaxed);
@@ -404,8 +253,16 @@ OptimisticLock::CompositeGuard::VerifyVersion()  //
     std::this_thread::yield();
   }
 
-  ver_ = static_cast<uint32_t>(cur & kVersionMask);
+  ver_ = static_cast<Version>(cur & kVersionMask);
   return ver_ == expected;
 }
 
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class BasicOptimisticLock<uint64_t>;
+template class BasicOptimisticLock<uint32_t>;
+template class BasicOptimisticLock<uint16_t>;
+
 }  // namespace dbgroup::lock
@@ -24,37 +24,14 @@
 // local sources
 #include "dbgroup/lock/common.hpp"
 
-namespace
-{
-/*##############################################################################
- * Local constants
- *############################################################################*/
-
-/// @brief A lock state representing no locks.
-constexpr uint64_t kNoLocks = 0b000UL;
-
-/// @brief A lock state representing a shared lock.
-constexpr uint64_t kSLock = 0b001UL;
-
-/// @brief A lock state representing a shared-with-intent-exclusive lock.
-constexpr uint64_t kSIXLock = 0b001UL << 62UL;
-
-/// @brief A lock state representing an exclusive lock.
-constexpr uint64_t kXLock = 0b010UL << 62UL;
-
-/// @brief A bit mask for extracting an SIX/X-lock state.
-constexpr uint64_t kXMask = kSIXLock | kXLock;
-
-}  // namespace
-
 namespace dbgroup::lock
 {
 /*##############################################################################
- * Public APIs
+ * Slow paths of lock acquisition
  *############################################################################*/
 
 auto
-PessimisticLock::LockS()  //
+PessimisticLock::LockSWithSpin()  //
     -> SGuard
 {
   SpinWithBackoff(
@@ -68,7 +45,7 @@ PessimisticLock::LockS()  //
 }
 
 auto
-PessimisticLock::LockX()  //
+PessimisticLock::LockXWithSpin()  //
     -> XGuard
 {
   SpinWithBackoff(
@@ -82,7 +59,7 @@ PessimisticLock::LockX()  //
 }
 
 auto
-PessimisticLock::LockSIX()  //
+PessimisticLock::LockSIXWithSpin()  //
     -> SIXGuard
 {
   SpinWithBackoff(
@@ -95,76 +72,10 @@ PessimisticLock::LockSIX()  //
   return SIXGuard{this};
 }
 
-/*##############################################################################
- * Internal APIs
- *############################################################################*/
-
-void
-PessimisticLock::UnlockS()
-{
-  lock_.fetch_sub(kSLock, kRelaxed);
-}
-
-void
-PessimisticLock::UnlockSIX()
-{
-  lock_.fetch_xor(kSIXLock, kRelaxed);
-}
-
-void
-PessimisticLock::UnlockX()
-{
-  lock_.store(kNoLocks, kRelease);
-}
-
-/*##############################################################################
- * Shared lock guards
- *############################################################################*/
-
-auto
-PessimisticLock::SGuard::operator=(  //
-    SGuard &&rhs) noexcept           //
-    -> SGuard &
-{
-  if (dest_) {
-    dest_->UnlockS();
-  }
-  dest_ = rhs.dest_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-PessimisticLock::SGuard::~SGuard()
-{
-  if (dest_) {
-    dest_->UnlockS();
-  }
-}
-
 /*##############################################################################
  * Shared-with-intent-exclusive lock guards
  *############################################################################*/
 
-auto
-PessimisticLock::SIXGuard::operator=(  //
-    SIXGuard &&rhs) noexcept           //
-    -> SIXGuard &
-{
-  if (dest_) {
-    dest_->UnlockSIX();
-  }
-  dest_ = rhs.dest_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-PessimisticLock::SIXGuard::~SIXGuard()
-{
-  if (dest_) {
-    dest_->UnlockSIX();
-  }
-}
-
 auto
 PessimisticLock::SIXGuard::UpgradeToX()  //
     -> XGuard
@@ -180,43 +91,7 @@ PessimisticLock::SIXGuard::UpgradeToX()  //
       },
       &(dest->lock_));
 
-  return XGuard{dest_};
-}
-
-/*##############################################################################
- * Exclusive lock guards
- *############################################################################*/
-
-auto
-PessimisticLock::XGuard::operator=(  //
-    XGuard &&rhs) noexcept           //
-    -> XGuard &
-{
-  if (dest_) {
-    dest_->UnlockX();
-  }
-  dest_ = rhs.dest_;
-  rhs.dest_ = nullptr;
-  return *this;
-}
-
-PessimisticLock::XGuard::~XGuard()
-{
-  if (dest_) {
-    dest_->UnlockX();
-  }
-}
-
-auto
-PessimisticLock::XGuard::DowngradeToSIX()  //
-    -> SIXGuard
-{
-  if (dest_ == nullptr) return SIXGuard{};
-  auto *dest = dest_;
-  dest_ = nullptr;  // release the ownership
-
-  dest->lock_.store(kSIXLock, kRelease);
-  return SIXGuard{dest};
+  return XGuard{dest};
 }
 
 }  // namespace dbgroup::lock
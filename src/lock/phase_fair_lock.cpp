@@ -0,0 +1,107 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/lock/phase_fair_lock.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <cstdint>
+
+// local sources
+#include "dbgroup/lock/common.hpp"
+
+namespace dbgroup::lock
+{
+/*##############################################################################
+ * Public APIs
+ *############################################################################*/
+
+auto
+PhaseFairLock::LockSIX()  //
+    -> SIXGuard
+{
+  AcquireTicket();
+  return SIXGuard{this};
+}
+
+auto
+PhaseFairLock::LockX()  //
+    -> XGuard
+{
+  AcquireTicket();
+  BlockReaders();
+  return XGuard{this};
+}
+
+/*##############################################################################
+ * Internal APIs
+ *############################################################################*/
+
+auto
+PhaseFairLock::LockSWithSpin(  //
+    const uint32_t w_bits)     //
+    -> SGuard
+{
+  // the writer or its successor counts this reader, so wait for a phase change
+  SpinWithBackoff(
+      [](std::atomic_uint32_t *rin, uint32_t w_bits) -> bool {
+        return (rin->load(kAcquire) & kWBits) != w_bits;
+      },
+      &rin_, w_bits);
+  return SGuard{this};
+}
+
+void
+PhaseFairLock::AcquireTicket()
+{
+  const auto ticket = win_.fetch_add(1U, kRelaxed);
+  SpinWithBackoff(
+      [](std::atomic_uint32_t *wout, uint32_t ticket) -> bool {
+        return wout->load(kAcquire) == ticket;
+      },
+      &wout_, ticket);
+}
+
+void
+PhaseFairLock::BlockReaders()
+{
+  // set a writer flag with a new phase ID, and then wait for earlier readers
+  const auto r_ticket = rin_.fetch_xor(kWPresent | kPhaseID, kAcqRel) & kRCntMask;
+  SpinWithBackoff(
+      [](std::atomic_uint32_t *rout, uint32_t r_ticket) -> bool {
+        return rout->load(kAcquire) == r_ticket;
+      },
+      &rout_, r_ticket);
+}
+
+/*##############################################################################
+ * Shared-with-intent-exclusive lock guards
+ *############################################################################*/
+
+auto
+PhaseFairLock::SIXGuard::UpgradeToX()  //
+    -> XGuard
+{
+  if (dest_ == nullptr) return XGuard{};
+  auto *dest = dest_;
+  dest_ = nullptr;  // release the ownership
+
+  dest->BlockReaders();
+  return XGuard{dest};
+}
+
+}  // namespace dbgroup::lock
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/random/hotspot.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * class HotspotDistribution
+ *############################################################################*/
+
+template <class IntType>
+HotspotDistribution<IntType>::HotspotDistribution() = default;
+
+template <class IntType>
+HotspotDistribution<IntType>::HotspotDistribution(  //
+    const IntType min,
+    const IntType max,
+    const double hot_fraction,
+    const double hot_prob)
+    : min_{min}, bin_num_{static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1}
+{
+  if (max < min) {
+    throw std::runtime_error{"The maximum value must be greater than the minimum one."};
+  }
+  if (bin_num_ == 0) {  // the number of values has wrapped around
+    throw std::runtime_error{"The range must not cover the whole 64-bit domain."};
+  }
+  if (!(hot_fraction > 0.0 && hot_fraction <= 1.0 && hot_prob >= 0.0 && hot_prob <= 1.0)) {
+    throw std::runtime_error{"The fractions of hot values and accesses must be in (0, 1]."};
+  }
+
+  // large numbers of values may be rounded up to 2^64 in double
+  const auto hot_num = static_cast<double>(bin_num_) * hot_fraction;
+  hot_num_ = hot_num >= static_cast<double>(bin_num_)
+                 ? bin_num_
+                 : std::max<uint64_t>(static_cast<uint64_t>(hot_num), 1);
+  const auto cold_num = bin_num_ - hot_num_;
+  hot_prob_ = cold_num == 0 ? 1.0 : hot_prob;
+  hot_scale_ = hot_prob_ > 0.0 ? static_cast<double>(hot_num_) / hot_prob_ : 0.0;
+  cold_scale_ = hot_prob_ < 1.0 ? static_cast<double>(cold_num) / (1.0 - hot_prob_) : 0.0;
+}
+
+/*##############################################################################
+ * class ShiftingHotspotDistribution
+ *############################################################################*/
+
+template <class IntType>
+ShiftingHotspotDistribution<IntType>::ShiftingHotspotDistribution() = default;
+
+template <class IntType>
+ShiftingHotspotDistribution<IntType>::ShiftingHotspotDistribution(  //
+    const IntType min,
+    const IntType max,
+    const double hot_fraction,
+    const double hot_prob,
+    const double drift_rate)
+    : base_{min, max, hot_fraction, hot_prob}, drift_rate_{drift_rate}
+{
+  if (!(drift_rate >= 0.0)) {
+    throw std::runtime_error{"The drift rate must not be negative."};
+  }
+}
+
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class HotspotDistribution<uint32_t>;
+template class HotspotDistribution<uint64_t>;
+template class HotspotDistribution<int32_t>;
+template class HotspotDistribution<int64_t>;
+template class ShiftingHotspotDistribution<uint32_t>;
+template class ShiftingHotspotDistribution<uint64_t>;
+template class ShiftingHotspotDistribution<int32_t>;
+template class ShiftingHotspotDistribution<int64_t>;
+
+}  // namespace dbgroup::random
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/random/latest.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Public constructors and assignment operators
+ *############################################################################*/
+
+template <class IntType>
+LatestDistribution<IntType>::LatestDistribution() = default;
+
+template <class IntType>
+LatestDistribution<IntType>::LatestDistribution(  //
+    const IntType min,
+    const IntType max,
+    const double alpha)
+    : min_{min}, zipf_{min, max, alpha}, max_{max}
+{
+}
+
+template <class IntType>
+LatestDistribution<IntType>::LatestDistribution(  //
+    const LatestDistribution &obj)
+    : min_{obj.min_}, zipf_{obj.zipf_}, max_{obj.GetMax()}
+{
+}
+
+template <class IntType>
+LatestDistribution<IntType>::LatestDistribution(  //
+    LatestDistribution &&obj) noexcept
+    : min_{obj.min_}, zipf_{std::move(obj.zipf_)}, max_{obj.GetMax()}
+{
+}
+
+template <class IntType>
+auto
+LatestDistribution<IntType>::operator=(  //
+    const LatestDistribution &obj)       //
+    -> LatestDistribution &
+{
+  min_ = obj.min_;
+  zipf_ = obj.zipf_;
+  max_.store(obj.GetMax(), std::memory_order_relaxed);
+  return *this;
+}
+
+template <class IntType>
+auto
+LatestDistribution<IntType>::operator=(  //
+    LatestDistribution &&obj) noexcept   //
+    -> LatestDistribution &
+{
+  min_ = obj.min_;
+  zipf_ = std::move(obj.zipf_);
+  max_.store(obj.GetMax(), std::memory_order_relaxed);
+  return *this;
+}
+
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class LatestDistribution<uint32_t>;
+template class LatestDistribution<uint64_t>;
+template class LatestDistribution<int32_t>;
+template class LatestDistribution<int64_t>;
+
+}  // namespace dbgroup::random
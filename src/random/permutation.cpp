@@ -0,0 +1,71 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/random/permutation.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+// local sources
+#include "dbgroup/random/engine.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Public constructors
+ *############################################################################*/
+
+template <class IntType>
+Permutation<IntType>::Permutation() = default;
+
+template <class IntType>
+Permutation<IntType>::Permutation(  //
+    const IntType min,
+    const IntType max,
+    const uint64_t seed)
+    : min_{min},
+      max_index_{static_cast<uint64_t>(max) - static_cast<uint64_t>(min)},
+      bits_{std::max<uint64_t>(std::bit_width(max_index_), 1)},
+      shift_{(bits_ + 1) / 2},
+      mask_{std::numeric_limits<uint64_t>::max() >> (64 - bits_)}
+{
+  if (max < min) {
+    throw std::runtime_error{"The maximum value must be greater than the minimum one."};
+  }
+
+  // derive round keys by using SplitMix64
+  SplitMix64 g{seed};
+  for (auto &&key : keys_) {
+    key = g() & mask_;
+  }
+}
+
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class Permutation<uint32_t>;
+template class Permutation<uint64_t>;
+template class Permutation<int32_t>;
+template class Permutation<int64_t>;
+
+}  // namespace dbgroup::random
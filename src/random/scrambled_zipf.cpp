@@ -0,0 +1,63 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/random/scrambled_zipf.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+
+// local sources
+#include "dbgroup/random/zipf.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * Public constructors
+ *############################################################################*/
+
+template <class IntType, class Base>
+ScrambledZipfDistribution<IntType, Base>::ScrambledZipfDistribution() = default;
+
+template <class IntType, class Base>
+ScrambledZipfDistribution<IntType, Base>::ScrambledZipfDistribution(  //
+    const IntType min,
+    const IntType max,
+    const double alpha,
+    const uint64_t seed)
+    : min_{min}, perm_{min, max, seed}, base_{min, max, alpha}
+{
+}
+
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class ScrambledZipfDistribution<uint32_t, ZipfDistribution<uint32_t>>;
+template class ScrambledZipfDistribution<uint64_t, ZipfDistribution<uint64_t>>;
+template class ScrambledZipfDistribution<int32_t, ZipfDistribution<int32_t>>;
+template class ScrambledZipfDistribution<int64_t, ZipfDistribution<int64_t>>;
+template class ScrambledZipfDistribution<uint32_t, ApproxZipfDistribution<uint32_t>>;
+template class ScrambledZipfDistribution<uint64_t, ApproxZipfDistribution<uint64_t>>;
+template class ScrambledZipfDistribution<int32_t, ApproxZipfDistribution<int32_t>>;
+template class ScrambledZipfDistribution<int64_t, ApproxZipfDistribution<int64_t>>;
+template class ScrambledZipfDistribution<uint32_t, AliasZipfDistribution<uint32_t>>;
+template class ScrambledZipfDistribution<uint64_t, AliasZipfDistribution<uint64_t>>;
+template class ScrambledZipfDistribution<int32_t, AliasZipfDistribution<int32_t>>;
+template class ScrambledZipfDistribution<int64_t, AliasZipfDistribution<int64_t>>;
+
+}  // namespace dbgroup::random
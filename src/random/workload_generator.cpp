@@ -0,0 +1,228 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/random/workload_generator.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+// local sources
+#include "dbgroup/random/common.hpp"
+
+namespace dbgroup::random
+{
+/*##############################################################################
+ * struct WorkloadConfig
+ *############################################################################*/
+
+auto
+WorkloadConfig::YCSB(  //
+    const char type,
+    const uint64_t record_num)  //
+    -> WorkloadConfig
+{
+  // YCSB's "zipfian" request distribution scatters hot keys over the key space
+  WorkloadConfig config{.record_num = record_num, .key_dist = KeyDistribution::kScrambledZipf};
+  switch (type) {
+    case 'A':
+    case 'a':
+      config.mix = {.read = 0.5, .update = 0.5};
+      break;
+    case 'B':
+    case 'b':
+      config.mix = {.read = 0.95, .update = 0.05};
+      break;
+    case 'C':
+    case 'c':
+      config.mix = {.read = 1.0};
+      break;
+    case 'D':
+    case 'd':
+      config.mix = {.read = 0.95, .insert = 0.05};
+      config.key_dist = KeyDistribution::kLatest;
+      break;
+    case 'E':
+    case 'e':
+      config.mix = {.insert = 0.05, .scan = 0.95};
+      break;
+    case 'F':
+    case 'f':
+      config.mix = {.read = 0.5, .read_modify_write = 0.5};
+      break;
+    default:
+      throw std::runtime_error{std::string{"Unknown YCSB workload: "} + type};
+  }
+  return config;
+}
+
+/*##############################################################################
+ * class WorkloadGenerator
+ *############################################################################*/
+
+WorkloadGenerator::WorkloadGenerator(  //
+    const WorkloadConfig &config,
+    const size_t thread_num,
+    const uint64_t seed)
+    : config_{config}, thread_num_{thread_num}
+{
+  if (config.record_num == 0 || thread_num == 0) {
+    throw std::runtime_error{"The numbers of records and threads must be positive."};
+  }
+  if (config.max_value_size < config.min_value_size || config.max_scan_length == 0) {
+    throw std::runtime_error{"The value sizes or scan lengths are invalid."};
+  }
+
+  // prepare the CDF of operation types
+  const auto &mix = config.mix;
+  op_cdf_ = {mix.read, mix.update, mix.insert, mix.scan, mix.read_modify_write};
+  for (size_t i = 1; i < kOpTypeNum; ++i) {
+    op_cdf_[i] += op_cdf_[i - 1];
+  }
+  const auto sum = op_cdf_.back();
+  if (!(sum > 0.0)) throw std::runtime_error{"The sum of operation proportions must be positive."};
+  for (auto &&p : op_cdf_) {
+    p /= sum;
+  }
+  op_cdf_.back() = 1.0;
+
+  // prepare distributions only if needed
+  const auto max_rank = config.record_num - 1;
+  switch (config.key_dist) {
+    case KeyDistribution::kZipf:
+      zipf_ = ZipfDistribution<uint64_t>{0, max_rank, config.skew, thread_num};
+      break;
+    case KeyDistribution::kHotspot:
+      hotspot_ = HotspotDistribution<uint64_t>{0, max_rank, config.hot_fraction, config.hot_prob};
+      break;
+    case KeyDistribution::kShiftingHotspot:
+      shifting_hotspot_ = ShiftingHotspotDistribution<uint64_t>{
+          0, max_rank, config.hot_fraction, config.hot_prob, config.drift_rate};
+      break;
+    case KeyDistribution::kScrambledZipf:
+      scrambled_zipf_ = ScrambledZipfDistribution<uint64_t>{0, max_rank, config.skew, seed};
+      break;
+    case KeyDistribution::kLatest:  // each stream has its own one
+    case KeyDistribution::kUniform:
+    default:
+      break;
+  }
+  if (config.scan_dist == LengthDistribution::kZipf) {
+    scan_zipf_ = ApproxZipfDistribution<uint32_t>{1, config.max_scan_length, config.skew};
+  }
+
+  // create per-thread streams by jumping a base engine
+  Xoshiro256StarStar engine{seed};
+  streams_.resize(thread_num);
+  for (size_t i = 0; i < thread_num; ++i) {
+    auto &s = streams_[i];
+    s.engine = engine;
+    s.next_key = config.record_num + i;
+    if (config.key_dist == KeyDistribution::kLatest) {
+      // the latest distribution uses the sequence numbers of visible keys
+      s.latest = LatestDistribution<uint64_t>{0, max_rank, config.skew};
+    }
+    engine.Jump();
+  }
+}
+
+auto
+WorkloadGenerator::Next(    //
+    const size_t thread_id)  //
+    -> Operation
+{
+  return Generate(streams_[thread_id]);
+}
+
+void
+WorkloadGenerator::Fill(  //
+    const size_t thread_id,
+    std::span<Operation> out)
+{
+  auto &s = streams_[thread_id];
+  for (auto &&op : out) {
+    op = Generate(s);
+  }
+}
+
+auto
+WorkloadGenerator::Generate(  //
+    Stream &s)                //
+    -> Operation
+{
+  // select an operation type
+  const auto p = GenerateUnitDouble(s.engine);
+  size_t type = 0;
+  while (p >= op_cdf_[type]) {
+    ++type;
+  }
+
+  ++s.op_num;
+  Operation op{.type = static_cast<OpType>(type)};
+  if (op.type == OpType::kInsert) {
+    op.key = s.next_key;
+    s.next_key += thread_num_;
+    if (config_.key_dist == KeyDistribution::kLatest) {
+      s.latest.Update(config_.record_num + s.insert_num);
+    }
+    ++s.insert_num;
+  } else {
+    op.key = GetExistingKey(s);
+  }
+
+  if (op.type != OpType::kScan) {
+    const auto range = config_.max_value_size - config_.min_value_size + 1UL;
+    op.len = config_.min_value_size + static_cast<uint32_t>(GenerateUnitDouble(s.engine) * range);
+  } else if (config_.scan_dist == LengthDistribution::kZipf) {
+    op.len = scan_zipf_(s.engine);
+  } else {
+    op.len = 1 + static_cast<uint32_t>(GenerateUnitDouble(s.engine) * config_.max_scan_length);
+  }
+  return op;
+}
+
+auto
+WorkloadGenerator::GetExistingKey(  //
+    Stream &s)                      //
+    -> uint64_t
+{
+  switch (config_.key_dist) {
+    case KeyDistribution::kZipf:
+      return zipf_(s.engine);
+    case KeyDistribution::kScrambledZipf:
+      return scrambled_zipf_(s.engine);
+    case KeyDistribution::kLatest: {
+      // convert a sequence number into an initial or inserted key
+      const auto seq = s.latest(s.engine);
+      if (seq < config_.record_num) return seq;
+      return s.next_key - (s.insert_num - (seq - config_.record_num)) * thread_num_;
+    }
+    case KeyDistribution::kHotspot:
+      return hotspot_(s.engine);
+    case KeyDistribution::kShiftingHotspot:
+      // use the total number of operations as a logical clock
+      return shifting_hotspot_(s.engine, s.op_num * thread_num_);
+    case KeyDistribution::kUniform:
+    default:
+      return static_cast<uint64_t>(GenerateUnitDouble(s.engine) * config_.record_num);
+  }
+}
+
+}  // namespace dbgroup::random
@@ -17,15 +17,89 @@
 // corresponding header
 #include "dbgroup/random/zipf.hpp"
 
+// system libraries
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 // C++ standard libraries
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace dbgroup::random
 {
+namespace
+{
+/*##############################################################################
+ * Local constants and structs
+ *############################################################################*/
+
+/// @brief A magic number for identifying CDF cache files.
+constexpr uint64_t kCacheMagic = 0x3246444346504958UL;  // "XIPFCDF2"
+
+/**
+ * @brief A class for representing headers of CDF cache files.
+ *
+ */
+struct CacheHeader {
+  /// @brief A magic number.
+  uint64_t magic{kCacheMagic};
+
+  /// @brief The number of bins.
+  uint64_t bin_num{};
+
+  /// @brief A skew parameter.
+  double alpha{};
+
+  /// @brief The sum of the unnormalized probabilities of all the bins.
+  double weight_sum{};
+
+  /// @brief The number of CDF values following this header.
+  uint64_t cdf_num{};
+};
+
+/*##############################################################################
+ * Local utility functions
+ *############################################################################*/
+
+/**
+ * @brief Run a given function with multiple threads.
+ *
+ * @param thread_num The number of threads.
+ * @param func A function that receives a thread ID.
+ */
+template <class Func>
+void
+RunInParallel(  //
+    const size_t thread_num,
+    const Func &func)
+{
+  std::vector<std::thread> threads{};
+  threads.reserve(thread_num - 1);
+  for (size_t i = 1; i < thread_num; ++i) {
+    threads.emplace_back(func, i);
+  }
+  func(0);
+  for (auto &&t : threads) {
+    t.join();
+  }
+}
+
+}  // namespace
+
 /*##############################################################################
  * class ZipfDistribution
  *############################################################################*/
@@ -33,47 +107,218 @@ namespace dbgroup::random
 template <class IntType>
 ZipfDistribution<IntType>::ZipfDistribution()
 {
-  UpdateCDF();
+  UpdateCDF(1);
 };
 
 template <class IntType>
 ZipfDistribution<IntType>::ZipfDistribution(  //
     const IntType min,
     const IntType max,
-    const double alpha)
+    const double alpha,
+    const size_t thread_num,
+    const std::filesystem::path &cache_dir)
     : min_{min}, max_{max}, alpha_{alpha}
 {
   if (max < min) {
     throw std::runtime_error{"The maximum value must be greater than the minimum one."};
   }
-  UpdateCDF();
+
+  if (cache_dir.empty()) {
+    UpdateCDF(thread_num);
+    return;
+  }
+
+  const auto &path = GetCachePath(cache_dir);
+  if (LoadCDF(path)) return;
+  UpdateCDF(thread_num);
+  StoreCDF(path);
 }
 
 template <class IntType>
 void
-ZipfDistribution<IntType>::UpdateCDF()
+ZipfDistribution<IntType>::UpdateCDF(  //
+    size_t thread_num)
 {
-  const auto bin_num = max_ - min_ + 1;
-  if (bin_num <= 1) {
-    zipf_cdf_ = {1.0};
-    return;
+  bin_num_ = static_cast<size_t>(max_ - min_) + 1;
+  const auto head_num = std::min(bin_num_, kHeadBinNum);
+  const auto cdf_num = head_num + (bin_num_ - head_num + kBlockSize - 1) / kBlockSize;
+  auto &&cdf = std::make_shared<std::vector<double>>(cdf_num);
+  thread_num = std::clamp<size_t>(thread_num, 1, cdf_num);
+
+  // each CDF value covers one head bin or one tail block
+  const auto get_begin_bin = [&](const size_t i) -> size_t {
+    if (i >= cdf_num) return bin_num_;
+    return i < head_num ? i : head_num + (i - head_num) * kBlockSize;
+  };
+
+  // accumulate unnormalized probabilities in each partition
+  std::vector<double> sums(thread_num + 1, 0.0);
+  RunInParallel(thread_num, [&](const size_t t) {
+    const auto begin = cdf_num * t / thread_num;
+    const auto end = cdf_num * (t + 1) / thread_num;
+    auto sum = 0.0;
+    for (auto i = begin, bin = get_begin_bin(begin); i < end; ++i) {
+      for (const auto end_bin = get_begin_bin(i + 1); bin < end_bin; ++bin) {
+        sum += GetWeight(bin);
+      }
+      (*cdf)[i] = sum;
+    }
+    sums[t + 1] = sum;
+  });
+
+  // add the prefix sums of partitions to all the values
+  for (size_t t = 1; t <= thread_num; ++t) {
+    sums[t] += sums[t - 1];
   }
+  RunInParallel(thread_num, [&](const size_t t) {
+    const auto begin = cdf_num * t / thread_num;
+    const auto end = cdf_num * (t + 1) / thread_num;
+    for (auto i = begin; i < end; ++i) {
+      (*cdf)[i] += sums[t];
+    }
+  });
+  weight_sum_ = cdf->back();
+  base_prob_ = 1.0 / weight_sum_;
+
+  cdf_vec_ = cdf.get();
+  const auto *data = cdf->data();
+  SetCDF(std::move(cdf), data);
+}
 
-  // compute a base probability
-  auto base_prob = 0.0;
-  for (IntType i = 1; i < bin_num + 1; ++i) {
-    base_prob += 1.0 / pow(i, alpha_);
+template <class IntType>
+void
+ZipfDistribution<IntType>::ExtendRange(  //
+    const IntType new_max)
+{
+  if (new_max < max_) {
+    throw std::runtime_error{"The new maximum value must not be less than the current one."};
   }
-  base_prob = 1.0 / base_prob;
+  const auto new_bin_num = static_cast<size_t>(new_max - min_) + 1;
+  if (new_bin_num == bin_num_) return;
 
-  // create a CDF according to Zipf's law
-  zipf_cdf_.reserve(bin_num);
-  zipf_cdf_.emplace_back(base_prob);
-  for (IntType i = 1; i < bin_num; ++i) {
-    const auto ith_prob = zipf_cdf_.at(i - 1) + base_prob / pow(i + 1, alpha_);
-    zipf_cdf_.emplace_back(ith_prob);
+  // copy the CDF if copied instances or a cache file share it
+  if (cdf_vec_ == nullptr || storage_.use_count() != 1) {
+    auto &&cdf = std::make_shared<std::vector<double>>(zipf_cdf_.begin(), zipf_cdf_.end());
+    cdf->insert(cdf->end(), block_cdf_.begin(), block_cdf_.end());
+    cdf_vec_ = cdf.get();
+    storage_ = std::move(cdf);
+  }
+
+  // append the weights of new bins, which may update the last block
+  auto &cdf = *cdf_vec_;
+  auto sum = weight_sum_;
+  for (auto pos = bin_num_; pos < new_bin_num; ++pos) {
+    sum += GetWeight(pos);
+    const auto i = pos < kHeadBinNum ? pos : kHeadBinNum + (pos - kHeadBinNum) / kBlockSize;
+    if (i < cdf.size()) {
+      cdf[i] = sum;
+    } else {
+      cdf.emplace_back(sum);
+    }
   }
-  zipf_cdf_.at(bin_num - 1) = 1.0;
+
+  max_ = new_max;
+  bin_num_ = new_bin_num;
+  weight_sum_ = sum;
+  base_prob_ = 1.0 / sum;
+  SetCDF(storage_, cdf.data());
+}
+
+template <class IntType>
+void
+ZipfDistribution<IntType>::SetCDF(  //
+    std::shared_ptr<const void> storage,
+    const double *cdf)
+{
+  const auto head_num = std::min(bin_num_, kHeadBinNum);
+  const auto block_num = (bin_num_ - head_num + kBlockSize - 1) / kBlockSize;
+  storage_ = std::move(storage);
+  zipf_cdf_ = std::span{cdf, head_num};
+  block_cdf_ = std::span{cdf + head_num, block_num};
+}
+
+template <class IntType>
+auto
+ZipfDistribution<IntType>::GetCachePath(         //
+    const std::filesystem::path &cache_dir) const  //
+    -> std::filesystem::path
+{
+  std::ostringstream name{};
+  name << "zipf_" << (static_cast<size_t>(max_ - min_) + 1) << "_" << std::hexfloat << alpha_
+       << ".cdf";
+  return cache_dir / name.str();
+}
+
+template <class IntType>
+auto
+ZipfDistribution<IntType>::LoadCDF(     //
+    const std::filesystem::path &path)  //
+    -> bool
+{
+  const auto fd = ::open(path.c_str(), O_RDONLY);  // NOLINT
+  if (fd < 0) return false;
+
+  // check the file size before mapping
+  struct stat st {};
+  const auto size = ::fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0UL;
+  auto *addr = size < sizeof(CacheHeader)
+                   ? MAP_FAILED
+                   : ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED) return false;
+  std::shared_ptr<const void> storage{addr, [size](const void *p) {
+                                        ::munmap(const_cast<void *>(p), size);  // NOLINT
+                                      }};
+
+  // verify the header
+  const auto bin_num = static_cast<size_t>(max_ - min_) + 1;
+  const auto head_num = std::min(bin_num, kHeadBinNum);
+  const auto cdf_num = head_num + (bin_num - head_num + kBlockSize - 1) / kBlockSize;
+  const auto *header = static_cast<const CacheHeader *>(addr);
+  if (header->magic != kCacheMagic || header->bin_num != bin_num || header->alpha != alpha_
+      || header->cdf_num != cdf_num || size != sizeof(CacheHeader) + cdf_num * sizeof(double)) {
+    return false;
+  }
+
+  bin_num_ = bin_num;
+  weight_sum_ = header->weight_sum;
+  base_prob_ = 1.0 / weight_sum_;
+  cdf_vec_ = nullptr;
+  SetCDF(std::move(storage), reinterpret_cast<const double *>(header + 1));  // NOLINT
+  return true;
+}
+
+template <class IntType>
+void
+ZipfDistribution<IntType>::StoreCDF(  //
+    const std::filesystem::path &path) const
+{
+  const CacheHeader header{
+      .bin_num = bin_num_,
+      .alpha = alpha_,
+      .weight_sum = weight_sum_,
+      .cdf_num = zipf_cdf_.size() + block_cdf_.size(),
+  };
+
+  // write a temporary file and rename it to avoid exposing partial files
+  auto tmp_path = path;
+  tmp_path += ".";
+  tmp_path += std::to_string(::getpid());
+  tmp_path += ".tmp";
+  {
+    std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+    out.write(reinterpret_cast<const char *>(&header), sizeof(CacheHeader));  // NOLINT
+    const auto *cdf = zipf_cdf_.data();
+    out.write(reinterpret_cast<const char *>(cdf), header.cdf_num * sizeof(double));  // NOLINT
+    if (!out) {
+      // caching is optional, so just give up
+      std::error_code ec{};
+      std::filesystem::remove(tmp_path, ec);
+      return;
+    }
+  }
+  std::error_code ec{};
+  std::filesystem::rename(tmp_path, path, ec);
 }
 
 /*##############################################################################
@@ -125,27 +370,137 @@ ApproxZipfDistribution<IntType>::UpdateCDF()
     zipf_cdf_.at(n_ - 1) = 1.0;
   } else {
     // compute a base probability approximately
-    constexpr size_t kSkipSize = 100;
-    auto base_prob = 0.0;
+    weight_sum_ = 0.0;
     IntType i = 1;
     while (i < static_cast<IntType>(kExactBinNum) + 1) {  // compute exact values
-      base_prob += 1.0 / pow(i++, alpha_);
+      weight_sum_ += 1.0 / pow(i++, alpha_);
     }
-    while (i < n_ + 1) {  // compute approximate values
-      const auto low = 1.0 / pow(i, alpha_);
-      i += kSkipSize;
-      const auto high = 1.0 / pow(i, alpha_);
-      base_prob += (low + high) * kSkipSize / 2;
-    }
-    base_prob = 1.0 / base_prob;
+    next_bin_ = i;
+    AccumulateApproxWeights();
+    UpdateHeadCDF();
+  }
+}
 
-    // create a CDF according to Zipf's law
-    zipf_cdf_.at(0) = base_prob;
-    for (IntType j = 1; j < static_cast<IntType>(kExactBinNum); ++j) {
-      const auto ith_prob = zipf_cdf_.at(j - 1) + base_prob / pow(j + 1, alpha_);
-      zipf_cdf_.at(j) = ith_prob;
+template <class IntType>
+void
+ApproxZipfDistribution<IntType>::ExtendRange(  //
+    const IntType new_max)
+{
+  if (new_max < max_) {
+    throw std::runtime_error{"The new maximum value must not be less than the current one."};
+  }
+  const auto old_n = n_;
+  max_ = new_max;
+  n_ = max_ - min_ + static_cast<IntType>(1);
+  c_ = 2 * GetHarmonicNum(n_);  // NOLINT
+  if (old_n <= static_cast<IntType>(kExactBinNum)) {
+    // small distributions do not have approximate weights
+    UpdateCDF();
+    return;
+  }
+
+  // continue the approximation from the last position
+  AccumulateApproxWeights();
+  UpdateHeadCDF();
+}
+
+template <class IntType>
+void
+ApproxZipfDistribution<IntType>::AccumulateApproxWeights()
+{
+  constexpr size_t kSkipSize = 100;
+  while (next_bin_ < n_ + 1) {  // compute approximate values
+    const auto low = 1.0 / pow(next_bin_, alpha_);
+    next_bin_ += kSkipSize;
+    const auto high = 1.0 / pow(next_bin_, alpha_);
+    weight_sum_ += (low + high) * kSkipSize / 2;
+  }
+}
+
+template <class IntType>
+void
+ApproxZipfDistribution<IntType>::UpdateHeadCDF()
+{
+  // create a CDF according to Zipf's law
+  const auto base_prob = 1.0 / weight_sum_;
+  zipf_cdf_.at(0) = base_prob;
+  for (IntType j = 1; j < static_cast<IntType>(kExactBinNum); ++j) {
+    const auto ith_prob = zipf_cdf_.at(j - 1) + base_prob / pow(j + 1, alpha_);
+    zipf_cdf_.at(j) = ith_prob;
+  }
+}
+
+/*##############################################################################
+ * class AliasZipfDistribution
+ *############################################################################*/
+
+template <class IntType>
+AliasZipfDistribution<IntType>::AliasZipfDistribution()
+{
+  UpdateAliasTable();
+}
+
+template <class IntType>
+AliasZipfDistribution<IntType>::AliasZipfDistribution(  //
+    const IntType min,
+    const IntType max,
+    const double alpha)
+    : min_{min}, max_{max}, alpha_{alpha}
+{
+  if (max < min) {
+    throw std::runtime_error{"The maximum value must be greater than the minimum one."};
+  }
+  UpdateAliasTable();
+}
+
+template <class IntType>
+void
+AliasZipfDistribution<IntType>::UpdateAliasTable()
+{
+  const size_t bin_num = max_ - min_ + 1;
+  bins_.resize(bin_num);
+  if (bin_num <= 1) return;
+
+  // compute probabilities scaled by the number of bins
+  auto sum = 0.0;
+  for (size_t i = 0; i < bin_num; ++i) {
+    const auto weight = 1.0 / pow(i + 1, alpha_);
+    bins_[i].prob = weight;
+    sum += weight;
+  }
+  const auto scale = static_cast<double>(bin_num) / sum;
+
+  // divide bins into small and large ones
+  std::vector<size_t> small{};
+  std::vector<size_t> large{};
+  for (size_t i = 0; i < bin_num; ++i) {
+    auto &prob = bins_[i].prob;
+    prob *= scale;
+    (prob < 1.0 ? small : large).emplace_back(i);
+  }
+
+  // fill each small bin with a part of a large bin
+  while (!small.empty() && !large.empty()) {
+    const auto s = small.back();
+    const auto l = large.back();
+    small.pop_back();
+    bins_[s].alias = l;
+
+    auto &l_prob = bins_[l].prob;
+    l_prob -= 1.0 - bins_[s].prob;
+    if (l_prob < 1.0) {
+      large.pop_back();
+      small.emplace_back(l);
     }
   }
+
+  // the remaining bins have probabilities of one except for rounding errors
+  for (const auto i : small) {
+    bins_[i].prob = 1.0;
+  }
+  for (const auto i : large) {
+    bins_[i].prob = 1.0;
+  }
 }
 
 /*##############################################################################
@@ -160,5 +515,9 @@ template class ApproxZipfDistribution<uint32_t>;
 template class ApproxZipfDistribution<uint64_t>;
 template class ApproxZipfDistribution<int32_t>;
 template class ApproxZipfDistribution<int64_t>;
+template class AliasZipfDistribution<uint32_t>;
+template class AliasZipfDistribution<uint64_t>;
+template class AliasZipfDistribution<int32_t>;
+template class AliasZipfDistribution<int64_t>;
 
 }  // namespace dbgroup::random
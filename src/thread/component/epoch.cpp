@@ -52,12 +52,21 @@ Epoch::GetProtectedEpoch() const  //
 void
 Epoch::EnterEpoch()
 {
+  if (depth_++ > 0) return;  // keep the outermost epoch
+  entered_.store(GetCurrentEpoch(), kRelaxed);
+}
+
+void
+Epoch::RefreshEpoch()
+{
+  if (depth_ > 1) return;  // nested guards may use the entered epoch
   entered_.store(GetCurrentEpoch(), kRelaxed);
 }
 
 void
 Epoch::LeaveEpoch()
 {
+  if (--depth_ > 0) return;
   entered_.store(std::numeric_limits<size_t>::max(), kRelaxed);
 }
 
@@ -20,9 +20,11 @@
 // C++ standard libraries
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <limits>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -41,20 +43,24 @@ namespace dbgroup::thread
  */
 EpochManager::EpochManager()
 {
-  auto &protected_epochs = ProtectedNode::GetProtectedEpochs(kInitialEpoch, protected_lists_);
+  auto *head = protected_lists_.load(std::memory_order_relaxed);
+  auto &protected_epochs = ProtectedNode::GetProtectedEpochs(kInitialEpoch, head);
   protected_epochs.emplace_back(kInitialEpoch);
 }
 
 EpochManager::~EpochManager()
 {
   // remove the retained protected epochs
-  [[maybe_unused]] const auto dummy = global_epoch_.load(std::memory_order_acquire);
-  auto *pro_next = protected_lists_;
+  [[maybe_unused]] const auto dummy = is_ticking_.load(std::memory_order_acquire);
+  auto *pro_next = protected_lists_.load(std::memory_order_relaxed);
   while (pro_next != nullptr) {
     auto *current = pro_next;
-    pro_next = current->next;
+    pro_next = current->next.load(std::memory_order_relaxed);
     delete current;
   }
+  for (auto &&[epoch, node] : removed_nodes_) {
+    delete node;
+  }
 }
 
 /*##############################################################################
@@ -75,13 +81,29 @@ EpochManager::GetMinEpoch() const  //
   return min_epoch_.load(std::memory_order_relaxed);
 }
 
+auto
+EpochManager::GetStats() const  //
+    -> Stats
+{
+  const auto cur_epoch = global_epoch_.load(std::memory_order_relaxed);
+  const auto min_epoch = min_epoch_.load(std::memory_order_relaxed);
+  return Stats{
+      .lag = cur_epoch > min_epoch ? cur_epoch - min_epoch : 0,
+      .oldest_thread_id = oldest_thread_id_.load(std::memory_order_relaxed),
+      .hold_time = std::chrono::nanoseconds{hold_time_.load(std::memory_order_relaxed)},
+      .tick_duration = std::chrono::nanoseconds{tick_duration_.load(std::memory_order_relaxed)},
+      .protected_num = protected_num_.load(std::memory_order_relaxed),
+  };
+}
+
 auto
 EpochManager::GetProtectedEpochs()  //
     -> std::pair<EpochGuard, const std::vector<size_t> &>
 {
   auto &&guard = CreateEpochGuard();
   const auto e = guard.GetProtectedEpoch();
-  const auto &protected_epochs = ProtectedNode::GetProtectedEpochs(e, protected_lists_);
+  auto *head = protected_lists_.load(std::memory_order_acquire);
+  const auto &protected_epochs = ProtectedNode::GetProtectedEpochs(e, head);
 
   return {std::move(guard), protected_epochs};
 }
@@ -90,58 +112,132 @@ auto
 EpochManager::CreateEpochGuard()  //
     -> EpochGuard
 {
-  auto &tls = tls_fields_[IDManager::GetThreadID()];
-  if (tls.heartbeat.expired()) {
-    tls.epoch.SetGrobalEpoch(&global_epoch_);
-    tls.heartbeat = IDManager::GetHeartBeat();
-  }
+  return EpochGuard{GetTLSEpoch()};
+}
 
-  return EpochGuard{&(tls.epoch)};
+auto
+EpochManager::CreateEpochSession()  //
+    -> EpochSession
+{
+  return EpochSession{GetTLSEpoch()};
 }
 
 void
 EpochManager::ForwardGlobalEpoch()
 {
+  while (!TryForwardGlobalEpoch()) {
+    std::this_thread::yield();
+  }
+}
+
+auto
+EpochManager::TryForwardGlobalEpoch()  //
+    -> bool
+{
+  // acquire the ownership of this tick
+  if (is_ticking_.load(std::memory_order_relaxed)
+      || is_ticking_.exchange(true, std::memory_order_acquire)) {
+    return false;
+  }
+
+  const auto now = std::chrono::steady_clock::now();
   const auto cur_epoch = global_epoch_.load(std::memory_order_relaxed);
   const auto next_epoch = cur_epoch + 1;
 
   // create a new node if needed
+  auto *head = protected_lists_.load(std::memory_order_relaxed);
   if ((next_epoch & kLowerMask) == 0UL) {
-    protected_lists_ = new ProtectedNode{next_epoch, protected_lists_};
+    head = new ProtectedNode{next_epoch, head};
+    protected_lists_.store(head, std::memory_order_release);
   }
 
   // update protected epoch values
-  auto &protected_epochs = ProtectedNode::GetProtectedEpochs(next_epoch, protected_lists_);
-  CollectProtectedEpochs(cur_epoch, protected_epochs);
-  RemoveOutDatedLists(protected_epochs);
+  auto &protected_epochs = ProtectedNode::GetProtectedEpochs(next_epoch, head);
+  CollectProtectedEpochs(cur_epoch, now, protected_epochs);
+  RemoveOutDatedLists(protected_epochs, next_epoch);
 
   // store the max/min epoch values for efficiency
+  const auto min_epoch = protected_epochs.back();
   global_epoch_.store(next_epoch, std::memory_order_release);
-  min_epoch_.store(protected_epochs.back(), std::memory_order_relaxed);
+  min_epoch_.store(min_epoch, std::memory_order_relaxed);
+  DeleteRemovedNodes(min_epoch);
+
+  // update statistics
+  const auto tick_duration = std::chrono::steady_clock::now() - now;
+  tick_duration_.store(tick_duration.count(), std::memory_order_relaxed);
+  protected_num_.store(protected_epochs.size(), std::memory_order_relaxed);
+  const auto need_callback = lag_callback_ && next_epoch - min_epoch >= lag_threshold_;
+  const auto stats = need_callback ? GetStats() : Stats{};
+
+  // release the ownership before callbacks so that they can advance epochs
+  is_ticking_.store(false, std::memory_order_release);
+  if (need_callback) {
+    lag_callback_(stats);
+  }
+  return true;
+}
+
+void
+EpochManager::SetLagCallback(  //
+    const size_t threshold,
+    LagCallback callback)
+{
+  lag_threshold_ = threshold;
+  lag_callback_ = std::move(callback);
 }
 
 /*##############################################################################
  * Internal APIs
  *############################################################################*/
 
+auto
+EpochManager::GetTLSEpoch()  //
+    -> Epoch *
+{
+  auto &tls = tls_fields_[IDManager::GetThreadID()];
+  if (tls.heartbeat.expired()) {
+    tls.epoch.SetGrobalEpoch(&global_epoch_);
+    tls.heartbeat = IDManager::GetHeartBeat();
+  }
+
+  return &(tls.epoch);
+}
+
 void
 EpochManager::CollectProtectedEpochs(  //
     const size_t cur_epoch,
+    const std::chrono::steady_clock::time_point now,
     std::vector<size_t> &protected_epochs)
 {
   protected_epochs.reserve(kMaxThreadNum);
   protected_epochs.emplace_back(cur_epoch + 1);  // reserve the next epoch
   protected_epochs.emplace_back(cur_epoch);
 
+  auto oldest_epoch = cur_epoch;
+  auto oldest_id = kNoThread;
+  auto oldest_at = now;
   for (size_t i = 0; i < kMaxThreadNum; ++i) {
     auto &tls = tls_fields_[i];
     if (tls.heartbeat.expired()) continue;
 
+    // track how long each thread has protected the same epoch
     const auto protected_epoch = tls.epoch.GetProtectedEpoch();
+    if (protected_epoch != tls.observed_epoch) {
+      tls.observed_epoch = protected_epoch;
+      tls.observed_at = now;
+    }
+
     if (protected_epoch < std::numeric_limits<size_t>::max()) {
       protected_epochs.emplace_back(protected_epoch);
+      if (protected_epoch < oldest_epoch) {
+        oldest_epoch = protected_epoch;
+        oldest_id = i;
+        oldest_at = tls.observed_at;
+      }
     }
   }
+  oldest_thread_id_.store(oldest_id, std::memory_order_relaxed);
+  hold_time_.store((now - oldest_at).count(), std::memory_order_relaxed);
 
   // remove duplicate values
   std::sort(protected_epochs.begin(), protected_epochs.end(), std::greater<size_t>{});
@@ -151,21 +247,22 @@ EpochManager::CollectProtectedEpochs(  //
 
 void
 EpochManager::RemoveOutDatedLists(  //
-    std::vector<size_t> &protected_epochs)
+    std::vector<size_t> &protected_epochs,
+    const size_t next_epoch)
 {
   const auto &it_end = protected_epochs.cend();
   auto &&it = protected_epochs.cbegin();
   auto protected_epoch = *it & kUpperMask;
 
   // remove out-dated lists
-  auto *prev = protected_lists_;
-  auto *current = protected_lists_;
-  while (current->next != nullptr) {
+  auto *prev = protected_lists_.load(std::memory_order_relaxed);
+  auto *current = prev;
+  while (current->next.load(std::memory_order_relaxed) != nullptr) {
     const auto upper_bits = current->GetUpperBits();
     if (protected_epoch == upper_bits) {
       // this node is still referred, so skip
       prev = current;
-      current = current->next;
+      current = current->next.load(std::memory_order_relaxed);
 
       // search the next protected epoch
       do {
@@ -179,14 +276,26 @@ EpochManager::RemoveOutDatedLists(  //
     }
 
     if (prev != current) {
-      // remove the out-dated list
-      prev->next = current->next;
-      delete current;
-      current = prev->next;
+      // remove the out-dated list, but other threads may be traversing it
+      current = current->next.load(std::memory_order_relaxed);
+      removed_nodes_.emplace_back(next_epoch, prev->next.load(std::memory_order_relaxed));
+      prev->next.store(current, std::memory_order_release);
     }
   }
 }
 
+void
+EpochManager::DeleteRemovedNodes(  //
+    const size_t min_epoch)
+{
+  // nodes are removed in ascending order of epochs
+  auto &&it = removed_nodes_.begin();
+  for (; it != removed_nodes_.end() && it->first < min_epoch; ++it) {
+    delete it->second;
+  }
+  removed_nodes_.erase(removed_nodes_.begin(), it);
+}
+
 /*##############################################################################
  * Internal class: ProtectedNode
  *############################################################################*/
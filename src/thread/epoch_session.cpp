@@ -0,0 +1,80 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the correspnding header
+#include "dbgroup/thread/epoch_session.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+
+namespace dbgroup::thread
+{
+EpochSession::EpochSession(  //
+    Epoch *epoch)
+    : epoch_{epoch}
+{
+  epoch_->EnterEpoch();
+}
+
+auto
+EpochSession::operator=(          //
+    EpochSession &&rhs) noexcept  //
+    -> EpochSession &
+{
+  if (epoch_ != nullptr) {
+    epoch_->LeaveEpoch();
+  }
+  epoch_ = rhs.epoch_;
+  rhs.epoch_ = nullptr;
+  return *this;
+}
+
+EpochSession::~EpochSession()
+{
+  if (epoch_ != nullptr) {
+    epoch_->LeaveEpoch();
+  }
+}
+
+auto
+EpochSession::GetProtectedEpoch() const  //
+    -> size_t
+{
+  return epoch_->GetProtectedEpoch();
+}
+
+auto
+EpochSession::GetLag() const  //
+    -> size_t
+{
+  return epoch_->GetCurrentEpoch() - epoch_->GetProtectedEpoch();
+}
+
+auto
+EpochSession::IsStale(           //
+    const size_t max_lag) const  //
+    -> bool
+{
+  return GetLag() > max_lag;
+}
+
+void
+EpochSession::Refresh()
+{
+  epoch_->RefreshEpoch();
+}
+
+}  // namespace dbgroup::thread
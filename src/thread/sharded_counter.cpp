@@ -0,0 +1,99 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/thread/sharded_counter.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// local sources
+#include "dbgroup/thread/common.hpp"
+#include "dbgroup/thread/id_manager.hpp"
+
+namespace dbgroup::thread
+{
+/*##############################################################################
+ * Public constructors
+ *############################################################################*/
+
+template <class T>
+ShardedCounter<T>::ShardedCounter(  //
+    const T batch_size)
+    : batch_size_{batch_size}
+{
+}
+
+/*##############################################################################
+ * Public getters
+ *############################################################################*/
+
+template <class T>
+auto
+ShardedCounter<T>::GetValue() const  //
+    -> T
+{
+  auto sum = global_.load(kRelaxed);
+  for (size_t i = 0; i < kMaxThreadNum; ++i) {
+    sum += cells_[i].val.load(kRelaxed);
+  }
+  return sum;
+}
+
+template <class T>
+auto
+ShardedCounter<T>::GetApproxValue() const  //
+    -> T
+{
+  return global_.load(kRelaxed);
+}
+
+/*##############################################################################
+ * Public APIs
+ *############################################################################*/
+
+template <class T>
+void
+ShardedCounter<T>::Add(  //
+    const T val)
+{
+  // only the owner thread modifies its cell, so we do not need RMW operations
+  auto &cell = cells_[IDManager::GetThreadID()].val;
+  const auto sum = cell.load(kRelaxed) + val;
+
+  bool within_batch = sum < batch_size_;
+  if constexpr (std::is_signed_v<T>) {
+    within_batch = within_batch && -sum < batch_size_;
+  }
+  if (within_batch) [[likely]] {
+    cell.store(sum, kRelaxed);
+    return;
+  }
+
+  global_.fetch_add(sum, kRelaxed);
+  cell.store(0, kRelaxed);
+}
+
+/*##############################################################################
+ * Explicit instantiation definitions
+ *############################################################################*/
+
+template class ShardedCounter<uint64_t>;
+template class ShardedCounter<int64_t>;
+
+}  // namespace dbgroup::thread
@@ -0,0 +1,255 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// corresponding header
+#include "dbgroup/thread/slab_allocator.hpp"
+
+// C++ standard libraries
+#include <bit>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+// local sources
+#include "dbgroup/thread/common.hpp"
+#include "dbgroup/thread/epoch_manager.hpp"
+#include "dbgroup/thread/id_manager.hpp"
+
+namespace dbgroup::thread
+{
+namespace
+{
+/*##############################################################################
+ * Local constants
+ *############################################################################*/
+
+/// @brief The number of blocks moved between thread local caches and a pool.
+constexpr size_t kTransferNum = SlabAllocator::kCacheCapacity / 2;
+
+/// @brief The bit shift for computing size classes.
+constexpr size_t kMinShift = std::countr_zero(SlabAllocator::kMinBlockSize);
+
+/// @brief The alignment of slabs.
+constexpr std::align_val_t kSlabAlign{kCashLineSize};
+
+}  // namespace
+
+/*##############################################################################
+ * Public constructors and destructors
+ *############################################################################*/
+
+SlabAllocator::SlabAllocator(  //
+    const EpochManager *epoch_manager)
+    : epoch_manager_{epoch_manager}
+{
+}
+
+SlabAllocator::~SlabAllocator()
+{
+  // large blocks are not in slabs, so release them individually
+  for (auto &&cache : caches_) {
+    auto *block = cache.retired_lists[kLargeClass].head;
+    while (block != nullptr) {
+      auto *next = block->next;
+      ::operator delete(block);
+      block = next;
+    }
+  }
+
+  for (auto *slab : slabs_) {
+    ::operator delete(slab, kSlabAlign);
+  }
+}
+
+/*##############################################################################
+ * Public APIs
+ *############################################################################*/
+
+auto
+SlabAllocator::Allocate(  //
+    const size_t size)    //
+    -> void *
+{
+  const auto cls = GetSizeClass(size);
+  if (cls == kLargeClass) return ::operator new(size);
+
+  auto &cache = caches_[IDManager::GetThreadID()];
+  auto &list = cache.free_lists[cls];
+  if (list.head == nullptr) [[unlikely]] {
+    Refill(cache, cls);
+  }
+
+  auto *block = list.head;
+  list.head = block->next;
+  --list.size;
+  return block;
+}
+
+void
+SlabAllocator::Deallocate(  //
+    void *ptr,
+    const size_t size)
+{
+  if (ptr == nullptr) return;
+
+  const auto cls = GetSizeClass(size);
+  if (cls == kLargeClass) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  auto &cache = caches_[IDManager::GetThreadID()];
+  auto &list = cache.free_lists[cls];
+  auto *block = new (ptr) Block{};
+  block->next = list.head;
+  list.head = block;
+  if (++list.size > kCacheCapacity) [[unlikely]] {
+    Spill(cache, cls);
+  }
+}
+
+void
+SlabAllocator::Retire(  //
+    void *ptr,
+    const size_t size)
+{
+  if (ptr == nullptr) return;
+  if (epoch_manager_ == nullptr) {
+    Deallocate(ptr, size);
+    return;
+  }
+
+  // retired blocks are sorted by epochs, so append the block to the tail
+  const auto cls = GetSizeClass(size);
+  auto &cache = caches_[IDManager::GetThreadID()];
+  auto &retired = cache.retired_lists[cls];
+  auto *block = new (ptr) Block{};
+  block->epoch = epoch_manager_->GetCurrentEpoch();
+  if (retired.tail == nullptr) {
+    retired.head = block;
+  } else {
+    retired.tail->next = block;
+  }
+  retired.tail = block;
+  ++retired.size;
+
+  Reclaim(cache, cls);
+  if (cls != kLargeClass && cache.free_lists[cls].size > kCacheCapacity) {
+    Spill(cache, cls);
+  }
+}
+
+/*##############################################################################
+ * Internal utility functions
+ *############################################################################*/
+
+auto
+SlabAllocator::GetSizeClass(  //
+    const size_t size)        //
+    -> size_t
+{
+  if (size <= kMinBlockSize) return 0;
+  if (size > kMaxBlockSize) return kLargeClass;
+  return std::bit_width(size - 1) - kMinShift;
+}
+
+void
+SlabAllocator::Reclaim(  //
+    TLSCache &cache,
+    const size_t cls)
+{
+  auto &retired = cache.retired_lists[cls];
+  if (retired.head == nullptr) return;
+
+  const auto min_epoch = epoch_manager_->GetMinEpoch();
+  while (retired.head != nullptr && retired.head->epoch < min_epoch) {
+    auto *block = retired.head;
+    retired.head = block->next;
+    --retired.size;
+
+    if (cls == kLargeClass) {
+      ::operator delete(block);
+    } else {
+      auto &list = cache.free_lists[cls];
+      block->next = list.head;
+      list.head = block;
+      ++list.size;
+    }
+  }
+  if (retired.head == nullptr) {
+    retired.tail = nullptr;
+  }
+}
+
+void
+SlabAllocator::Refill(  //
+    TLSCache &cache,
+    const size_t cls)
+{
+  auto &list = cache.free_lists[cls];
+  if (epoch_manager_ != nullptr) {
+    Reclaim(cache, cls);
+    if (list.head != nullptr) return;
+  }
+
+  void *slab{};
+  {
+    const std::lock_guard guard{mtx_};
+    auto *pooled = central_pool_[cls];
+    if (pooled != nullptr) {
+      central_pool_[cls] = pooled->next_list;
+      list.head = pooled;
+      list.size = kTransferNum;
+      return;
+    }
+
+    slab = ::operator new(kSlabSize, kSlabAlign);
+    slabs_.emplace_back(slab);
+  }
+
+  // carve the new slab so that lower addresses are used first
+  const auto block_size = kMinBlockSize << cls;
+  auto *addr = static_cast<std::byte *>(slab);
+  for (auto offset = kSlabSize; offset > 0;) {
+    offset -= block_size;
+    auto *block = new (addr + offset) Block{};
+    block->next = list.head;
+    list.head = block;
+    ++list.size;
+  }
+}
+
+void
+SlabAllocator::Spill(  //
+    TLSCache &cache,
+    const size_t cls)
+{
+  // keep recently freed blocks in this cache and move the remaining ones
+  auto &list = cache.free_lists[cls];
+  auto *last = list.head;
+  for (size_t i = kTransferNum + 1; i < list.size; ++i) {
+    last = last->next;
+  }
+  auto *head = last->next;
+  last->next = nullptr;
+  list.size -= kTransferNum;
+
+  const std::lock_guard guard{mtx_};
+  head->next_list = central_pool_[cls];
+  central_pool_[cls] = head;
+}
+
+}  // namespace dbgroup::thread
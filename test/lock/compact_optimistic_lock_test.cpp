@@ -0,0 +1,244 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/optimistic_lock.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kWriteNumPerThread = 1E5;
+constexpr std::chrono::milliseconds kWaitTimeMill{10};
+
+// the 64-bit instance is the original optimistic lock
+static_assert(std::is_same_v<OptimisticLock, BasicOptimisticLock<uint64_t>>);
+static_assert(sizeof(OptimisticLock) == sizeof(uint64_t));
+static_assert(std::is_same_v<OptimisticLock::Version, uint32_t>);
+
+template <class Word>
+class CompactOptimisticLockFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Types
+   *##########################################################################*/
+
+  using Lock_t = BasicOptimisticLock<Word>;
+  using Version = typename Lock_t::Version;
+
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kMaxSLockNum = (1UL << (sizeof(Word) * 8 / 2 - 2)) - 1;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyLayout()
+  {
+    EXPECT_EQ(sizeof(Lock_t), sizeof(Word));
+    EXPECT_EQ(sizeof(Version) * 2, sizeof(Word));
+  }
+
+  void
+  VerifyOptimisticRead()
+  {
+    auto &&opt_guard = lock_.GetVersion();
+    EXPECT_TRUE(opt_guard.VerifyVersion());
+    {
+      [[maybe_unused]] const auto &s_guard = lock_.LockS();
+      [[maybe_unused]] const auto &six_guard = lock_.LockSIX();
+    }
+    EXPECT_TRUE(opt_guard.VerifyVersion());
+    {
+      [[maybe_unused]] const auto &x_guard = lock_.LockX();
+    }
+    EXPECT_FALSE(opt_guard.VerifyVersion());
+    EXPECT_TRUE(opt_guard.VerifyVersion());
+
+    // try-locks succeed only with the current version
+    auto old_guard = opt_guard;
+    EXPECT_TRUE(opt_guard.TryLockX());
+    EXPECT_FALSE(old_guard.TryLockS());
+    EXPECT_TRUE(old_guard.TryLockS());
+    EXPECT_TRUE(lock_.PrepareRead().VerifyVersion());
+  }
+
+  void
+  VerifyUpgradeAndDowngrade()
+  {
+    auto &&opt_guard = lock_.GetVersion();
+    auto &&x_guard = lock_.LockSIX().UpgradeToX();
+    ASSERT_TRUE(x_guard);
+    EXPECT_EQ(x_guard.GetVersion(), opt_guard.GetVersion());
+    x_guard.SetVersion(x_guard.GetVersion() + 2);
+    {
+      [[maybe_unused]] const auto &six_guard = x_guard.DowngradeToSIX();
+    }
+    EXPECT_FALSE(opt_guard.VerifyVersion());
+    EXPECT_EQ(opt_guard.GetVersion(), 2);
+  }
+
+  void
+  VerifyVersionWrapAround()
+  {
+    constexpr size_t kVersionNum = std::numeric_limits<Version>::max() + 1UL;
+    auto &&opt_guard = lock_.GetVersion();
+    for (size_t i = 0; i < kVersionNum - 1; ++i) {
+      [[maybe_unused]] const auto &x_guard = lock_.LockX();
+    }
+    EXPECT_EQ(lock_.GetVersion().GetVersion(), std::numeric_limits<Version>::max());
+    {
+      [[maybe_unused]] const auto &x_guard = lock_.LockX();
+    }
+
+    // a version overflows into zero without affecting lock states
+    EXPECT_EQ(lock_.GetVersion().GetVersion(), 0);
+    EXPECT_TRUE(opt_guard.VerifyVersion());
+    EXPECT_TRUE(lock_.LockS());
+    EXPECT_TRUE(lock_.LockX());
+  }
+
+  void
+  VerifySLockCounterLimit()
+  {
+    std::vector<typename Lock_t::SGuard> guards{};
+    guards.reserve(kMaxSLockNum);
+    for (size_t i = 0; i < kMaxSLockNum; ++i) {
+      guards.emplace_back(lock_.LockS());
+    }
+
+    // the counter is full, so another S lock must wait
+    std::atomic_bool acquired{false};
+    std::thread t{[&]() {
+      [[maybe_unused]] const auto &guard = lock_.LockS();
+      acquired = true;
+    }};
+    std::this_thread::sleep_for(kWaitTimeMill);
+    EXPECT_FALSE(acquired);
+    EXPECT_TRUE(lock_.GetVersion().VerifyVersion());
+
+    guards.pop_back();
+    t.join();
+    EXPECT_TRUE(acquired);
+  }
+
+  void
+  VerifyXLockByMultipleThreads()
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([this]() {
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          [[maybe_unused]] const auto &guard = lock_.LockX();
+          ++counter_;
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    EXPECT_EQ(counter_, kThreadNum * kWriteNumPerThread);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  Lock_t lock_{};
+
+  size_t counter_{0};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using WordTypes = ::testing::Types<uint32_t, uint16_t>;
+TYPED_TEST_SUITE(CompactOptimisticLockFixture, WordTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(CompactOptimisticLockFixture, LockHasSameSizeAsWord)
+{
+  TestFixture::VerifyLayout();
+}
+
+TYPED_TEST(CompactOptimisticLockFixture, VersionIsModifiedOnlyByXLock)
+{
+  TestFixture::VerifyOptimisticRead();
+}
+
+TYPED_TEST(CompactOptimisticLockFixture, UpgradeAndDowngradeKeepVersion)
+{
+  TestFixture::VerifyUpgradeAndDowngrade();
+}
+
+TYPED_TEST(CompactOptimisticLockFixture, VersionWrapsAroundAfterOverflow)
+{
+  TestFixture::VerifyVersionWrapAround();
+}
+
+TYPED_TEST(CompactOptimisticLockFixture, SLockWaitsIfCounterIsFull)
+{
+  TestFixture::VerifySLockCounterLimit();
+}
+
+TYPED_TEST(CompactOptimisticLockFixture, XLockByMultipleThreadsIsSerialized)
+{
+  TestFixture::VerifyXLockByMultipleThreads();
+}
+
+}  // namespace dbgroup::lock::test
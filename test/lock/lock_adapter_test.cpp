@@ -0,0 +1,190 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/lock_adapter.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/lock/concepts.hpp"
+#include "dbgroup/lock/mcs_lock.hpp"
+#include "dbgroup/lock/optimistic_lock.hpp"
+#include "dbgroup/lock/optiql.hpp"
+#include "dbgroup/lock/pessimistic_lock.hpp"
+#include "dbgroup/lock/phase_fair_lock.hpp"
+#include "dbgroup/lock/ticket_lock.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Static assertions for lock concepts
+ *############################################################################*/
+
+static_assert(SIXLockable<PessimisticLock>);
+static_assert(SIXLockable<OptimisticLock>);
+static_assert(SIXLockable<OptimisticLock32>);
+static_assert(SIXLockable<OptimisticLock16>);
+static_assert(SIXLockable<MCSLock>);
+static_assert(SIXLockable<PhaseFairLock>);
+static_assert(ExclusiveLockable<OptiQL> && !SharedLockable<OptiQL>);
+static_assert(ExclusiveLockable<TicketLock<>> && !SharedLockable<TicketLock<>>);
+
+static_assert(!OptimisticLockable<PessimisticLock>);
+static_assert(!OptimisticLockable<MCSLock>);
+static_assert(UpgradableOptimisticLockable<OptimisticLock>);
+static_assert(UpgradableOptimisticLockable<OptimisticLock16>);
+static_assert(OptimisticLockable<OptiQL> && !UpgradableOptimisticLockable<OptiQL>);
+
+static_assert(SharedLockable<LockAdapter<OptiQL>>);
+static_assert(OptimisticLockable<LockAdapter<OptiQL>>);
+
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kWriteNumPerThread = 1E4;
+
+template <class Lock>
+class LockAdapterFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Types
+   *##########################################################################*/
+
+  using Adapter_t = LockAdapter<Lock>;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyLayout()
+  {
+    EXPECT_EQ(sizeof(Adapter_t), sizeof(Lock));
+    EXPECT_EQ(Adapter_t::kHasSLock, SharedLockable<Lock>);
+    EXPECT_EQ(Adapter_t::kHasSIXLock, SIXLockable<Lock>);
+    EXPECT_EQ(Adapter_t::kIsOptimistic, OptimisticLockable<Lock>);
+  }
+
+  void
+  VerifyLockWithEachMode()
+  {
+    {
+      auto &&s_guard = lock_.LockS();
+      EXPECT_TRUE(s_guard);
+    }
+    {
+      auto &&six_guard = lock_.LockSIX();
+      EXPECT_TRUE(six_guard);
+    }
+    {
+      auto &&x_guard = lock_.LockX();
+      EXPECT_TRUE(x_guard);
+    }
+  }
+
+  void
+  VerifyMutualExclusion()
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([this]() {
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          if (j % 2 == 0) {
+            [[maybe_unused]] const auto &guard = lock_.LockX();
+            ++counter_;
+          } else if constexpr (Adapter_t::kHasSIXLock) {
+            // SIX locks of original classes exclude only other SIX/X locks
+            [[maybe_unused]] const auto &guard = lock_.LockSIX().UpgradeToX();
+            ++counter_;
+          } else {
+            [[maybe_unused]] const auto &guard = lock_.LockSIX();
+            ++counter_;
+          }
+          {  // S locks exclude writers
+            [[maybe_unused]] const auto &guard = lock_.LockS();
+            [[maybe_unused]] volatile auto cnt = counter_;
+          }
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    EXPECT_EQ(counter_, kThreadNum * kWriteNumPerThread);
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  Adapter_t lock_{};
+
+  size_t counter_{0};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using LockTypes =
+    ::testing::Types<PessimisticLock, OptimisticLock, MCSLock, OptiQL, PhaseFairLock>;
+TYPED_TEST_SUITE(LockAdapterFixture, LockTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(LockAdapterFixture, AdapterHasSameSizeAsLock)
+{
+  TestFixture::VerifyLayout();
+}
+
+TYPED_TEST(LockAdapterFixture, LockWithEachModeReturnValidGuards)
+{
+  TestFixture::VerifyLockWithEachMode();
+}
+
+TYPED_TEST(LockAdapterFixture, LockByMultipleThreadsIsSerialized)
+{
+  TestFixture::VerifyMutualExclusion();
+}
+
+}  // namespace dbgroup::lock::test
@@ -0,0 +1,232 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/lock_set.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/lock/mcs_lock.hpp"
+#include "dbgroup/lock/optimistic_lock.hpp"
+#include "dbgroup/lock/optiql.hpp"
+#include "dbgroup/lock/pessimistic_lock.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kLockNum = 16;
+constexpr size_t kLockNumPerTxn = 4;
+constexpr size_t kTxnNumPerThread = 1E4;
+constexpr size_t kSmallInlineNum = 2;
+
+template <class Lock>
+class LockSetFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  template <size_t kInlineNum>
+  void
+  VerifyConcurrentAcquisition()
+  {
+    std::vector<size_t> expected(kThreadNum, 0);
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([this, i, &expected]() {
+        std::mt19937_64 rand_engine{kRandomSeed + i};  // NOLINT
+        std::uniform_int_distribution<size_t> id_dist{0, kLockNum - 1};
+        LockSet<kInlineNum> lock_set{};
+        size_t cnt = 0;
+        for (size_t j = 0; j < kTxnNumPerThread; ++j) {
+          // register locks in random order (duplicates are merged)
+          std::array<size_t, kLockNumPerTxn> ids{};
+          for (auto &&id : ids) {
+            id = id_dist(rand_engine);
+            lock_set.Add(locks_[id], LockMode::kX);
+          }
+          ASSERT_TRUE(lock_set.Acquire());
+
+          std::sort(ids.begin(), ids.end());
+          auto end = std::unique(ids.begin(), ids.end());
+          const auto uniq_num = static_cast<size_t>(end - ids.begin());
+          ASSERT_EQ(lock_set.GetSize(), uniq_num);
+          for (auto it = ids.begin(); it != end; ++it) {
+            ++counters_[*it];
+          }
+          cnt += uniq_num;
+          lock_set.Release();
+          ASSERT_EQ(lock_set.GetSize(), 0);
+        }
+        expected[i] = cnt;
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    // lost increments mean that X locks did not exclude each other
+    size_t sum = 0;
+    for (const auto cnt : counters_) {
+      sum += cnt;
+    }
+    size_t expected_sum = 0;
+    for (const auto cnt : expected) {
+      expected_sum += cnt;
+    }
+    EXPECT_EQ(sum, expected_sum);
+  }
+
+  void
+  VerifyWeakerModes()
+  {
+    LockSet lock_set{};
+    lock_set.Add(locks_[0], LockMode::kS);
+    lock_set.Add(locks_[1], LockMode::kSIX);
+    lock_set.Add(locks_[0], LockMode::kS);
+    ASSERT_TRUE(lock_set.Acquire());
+    EXPECT_TRUE(lock_set.HasLocks());
+    EXPECT_EQ(lock_set.GetSize(), 2);
+    lock_set.Release();
+    EXPECT_FALSE(lock_set.HasLocks());
+
+    // all the locks are released
+    std::array<typename Lock::XGuard, kLockNum> guards{};
+    for (size_t i = 0; i < kLockNum; ++i) {
+      guards[i] = locks_[i].LockX();
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::array<Lock, kLockNum> locks_{};
+
+  std::array<size_t, kLockNum> counters_{};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using LockTypes = ::testing::Types<PessimisticLock, OptimisticLock, MCSLock, OptiQL>;
+TYPED_TEST_SUITE(LockSetFixture, LockTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(LockSetFixture, AcquireRandomLocksConcurrentlyWithoutDeadlocks)
+{
+  TestFixture::template VerifyConcurrentAcquisition<kLockNumPerTxn>();
+}
+
+TYPED_TEST(LockSetFixture, AcquireLocksExceedingInlineNumWithoutDeadlocks)
+{
+  TestFixture::template VerifyConcurrentAcquisition<kSmallInlineNum>();
+}
+
+TYPED_TEST(LockSetFixture, AcquireWeakerModesAndReleaseAll)
+{
+  TestFixture::VerifyWeakerModes();
+}
+
+/*------------------------------------------------------------------------------
+ * Optimistic guard tests
+ *----------------------------------------------------------------------------*/
+
+TEST(LockSetTest, UpgradeOptimisticGuardsWithValidVersions)
+{
+  std::array<OptimisticLock, 3> locks{};
+  std::array<OptimisticLock::OptGuard, 3> opt_guards{};
+  for (size_t i = 0; i < locks.size(); ++i) {
+    opt_guards[i] = locks[i].GetVersion();
+  }
+
+  LockSet lock_set{};
+  lock_set.Add(locks[2], opt_guards[2], LockMode::kX);
+  lock_set.Add(locks[0], opt_guards[0], LockMode::kS);
+  lock_set.Add(locks[1], opt_guards[1], LockMode::kSIX);
+  ASSERT_TRUE(lock_set.Acquire());
+  lock_set.Release();
+
+  // only the X lock modifies its version
+  EXPECT_TRUE(opt_guards[0].VerifyVersion());
+  EXPECT_TRUE(opt_guards[1].VerifyVersion());
+  EXPECT_FALSE(opt_guards[2].VerifyVersion());
+}
+
+TEST(LockSetTest, UpgradeOptimisticGuardsWithStaleVersionReleaseAll)
+{
+  std::array<OptimisticLock, 3> locks{};
+  std::array<OptimisticLock::OptGuard, 3> opt_guards{};
+  for (size_t i = 0; i < locks.size(); ++i) {
+    opt_guards[i] = locks[i].GetVersion();
+  }
+  {  // another thread modifies the last lock
+    [[maybe_unused]] const auto &x_guard = locks[2].LockX();
+  }
+
+  LockSet lock_set{};
+  PessimisticLock pess_lock{};
+  for (size_t i = 0; i < locks.size(); ++i) {
+    lock_set.Add(locks[i], opt_guards[i], LockMode::kX);
+  }
+  lock_set.Add(pess_lock, LockMode::kX);
+  EXPECT_FALSE(lock_set.Acquire());
+  EXPECT_FALSE(lock_set.HasLocks());
+  EXPECT_EQ(lock_set.GetSize(), 0);
+
+  // the acquired locks are released without modifying versions
+  for (size_t i = 0; i < locks.size() - 1; ++i) {
+    EXPECT_TRUE(opt_guards[i].VerifyVersion());
+    EXPECT_TRUE(locks[i].GetVersion().TryLockX());
+  }
+  EXPECT_TRUE(pess_lock.LockX());
+}
+
+}  // namespace dbgroup::lock::test
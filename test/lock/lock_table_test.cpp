@@ -0,0 +1,230 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/lock_table.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/lock/mcs_lock.hpp"
+#include "dbgroup/lock/optimistic_lock.hpp"
+#include "dbgroup/lock/optiql.hpp"
+#include "dbgroup/lock/pessimistic_lock.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kKeyNum = 64;
+constexpr size_t kBatchSize = 4;
+constexpr size_t kWriteNumPerThread = 1E4;
+constexpr size_t kStripesPerThread = 4;
+constexpr std::chrono::milliseconds kWaitTimeMill{10};
+
+template <class Lock>
+class LockTableFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Types
+   *##########################################################################*/
+
+  using LockTable_t = LockTable<Lock>;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyConstructor()
+  {
+    const LockTable_t table{3, 0, kStripesPerThread};
+    EXPECT_EQ(table.GetStripeNum(), 16);
+    EXPECT_EQ(table.GetSplitNum(), 0);
+
+    // the same key is always mapped to the same lock
+    for (uint64_t key = 0; key < kKeyNum; ++key) {
+      EXPECT_EQ(&table.GetLock(key), &table.GetLock(key));
+    }
+  }
+
+  void
+  VerifyLockX(  //
+      LockTable_t &table)
+  {
+    RunWorkers([&](std::mt19937_64 &rand_engine, std::uniform_int_distribution<uint64_t> &dist) {
+      const auto key = dist(rand_engine);
+      [[maybe_unused]] const auto &guard = table.LockX(key);
+      ++counters_[key];
+    });
+    EXPECT_EQ(Sum(), kThreadNum * kWriteNumPerThread);
+  }
+
+  void
+  VerifyLockBatch()
+  {
+    LockTable_t table{kThreadNum, 0, kStripesPerThread};
+    RunWorkers([&](std::mt19937_64 &rand_engine, std::uniform_int_distribution<uint64_t> &dist) {
+      std::array<uint64_t, kBatchSize> keys{};
+      for (auto &&key : keys) {
+        key = dist(rand_engine);
+      }
+      std::sort(keys.begin(), keys.end());
+      const auto *end = std::unique(keys.begin(), keys.end());
+
+      LockSet lock_set{};
+      ASSERT_TRUE(table.LockBatch(std::span<const uint64_t>{keys.begin(), end},  //
+                                  LockMode::kX, lock_set));
+      for (const auto *it = keys.begin(); it != end; ++it) {
+        ++counters_[*it];
+      }
+      lock_set.Release();
+    });
+
+    const auto sum = Sum();
+    EXPECT_GE(sum, kThreadNum * kWriteNumPerThread);
+    EXPECT_LE(sum, kThreadNum * kWriteNumPerThread * kBatchSize);
+  }
+
+  void
+  VerifySplitHotStripes()
+  {
+    constexpr uint64_t kHotKey = 0;
+    LockTable_t table{kThreadNum, 1, kStripesPerThread};
+    EXPECT_EQ(table.SplitHotStripes(), 0);
+
+    std::thread t{};
+    {  // make the hot stripe contended
+      [[maybe_unused]] const auto &guard = table.LockX(kHotKey);
+      t = std::thread{[&]() { [[maybe_unused]] const auto &g = table.LockX(kHotKey); }};
+      std::this_thread::sleep_for(kWaitTimeMill);
+    }
+    t.join();
+    const auto *old_lock = &table.GetLock(kHotKey);
+    EXPECT_EQ(table.SplitHotStripes(), 1);
+    EXPECT_EQ(table.GetSplitNum(), 1);
+    EXPECT_NE(&table.GetLock(kHotKey), old_lock);
+    EXPECT_EQ(table.SplitHotStripes(), 0);
+
+    // split stripes keep mutual exclusion
+    VerifyLockX(table);
+  }
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  template <class Func>
+  static void
+  RunWorkers(  //
+      Func &&func)
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([&, i]() {
+        std::mt19937_64 rand_engine{kRandomSeed + i};  // NOLINT
+        std::uniform_int_distribution<uint64_t> dist{0, kKeyNum - 1};
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          func(rand_engine, dist);
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+  }
+
+  [[nodiscard]] auto
+  Sum() const  //
+      -> size_t
+  {
+    size_t sum = 0;
+    for (const auto cnt : counters_) {
+      sum += cnt;
+    }
+    return sum;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::array<size_t, kKeyNum> counters_{};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using LockTypes = ::testing::Types<PessimisticLock, OptimisticLock, MCSLock, OptiQL>;
+TYPED_TEST_SUITE(LockTableFixture, LockTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(LockTableFixture, ConstructorRoundUpStripeNum)
+{
+  TestFixture::VerifyConstructor();
+}
+
+TYPED_TEST(LockTableFixture, LockXByMultipleThreadsIsSerialized)
+{
+  LockTable<TypeParam> table{kThreadNum, 0, kStripesPerThread};
+  TestFixture::VerifyLockX(table);
+}
+
+TYPED_TEST(LockTableFixture, LockBatchByMultipleThreadsIsSerialized)
+{
+  TestFixture::VerifyLockBatch();
+}
+
+TYPED_TEST(LockTableFixture, SplitHotStripesChangeLocksOfContendedKeys)
+{
+  TestFixture::VerifySplitHotStripes();
+}
+
+}  // namespace dbgroup::lock::test
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/optimistic_read.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/lock/mcs_lock.hpp"
+#include "dbgroup/lock/optimistic_lock.hpp"
+#include "dbgroup/lock/optiql.hpp"
+#include "dbgroup/lock/pessimistic_lock.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kWriteNumPerThread = 1E4;
+constexpr size_t kReadNumPerThread = 1E4;
+
+template <class Lock>
+class OptimisticReadFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyReadWithoutWriters()
+  {
+    size_t call_num = 0;
+    const auto &[a, b] = OptimisticRead(lock_, [&]() {
+      ++call_num;
+      return ReadPair();
+    });
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(call_num, 1);
+
+    OptimisticRead(lock_, [&]() { ++call_num; });
+    EXPECT_EQ(call_num, 2);
+  }
+
+  void
+  VerifyReadWithWriters(  //
+      const size_t retry_num)
+  {
+    std::atomic_size_t running_num{kThreadNum};
+    std::vector<std::thread> threads{};
+    threads.reserve(2 * kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([&]() {
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          [[maybe_unused]] const auto &guard = lock_.LockX();
+          const auto val = a_.load(std::memory_order_relaxed) + 1;
+          a_.store(val, std::memory_order_relaxed);
+          b_.store(val, std::memory_order_relaxed);
+        }
+        running_num.fetch_sub(1, std::memory_order_relaxed);
+      });
+      threads.emplace_back([&]() {
+        for (size_t j = 0; j < kReadNumPerThread; ++j) {
+          const auto &[a, b] = OptimisticRead(lock_, [this]() { return ReadPair(); }, retry_num);
+          ASSERT_EQ(a, b);
+          if (running_num.load(std::memory_order_relaxed) == 0) break;
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    EXPECT_EQ(a_.load(std::memory_order_relaxed), kThreadNum * kWriteNumPerThread);
+  }
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  auto
+  ReadPair() const  //
+      -> std::pair<uint64_t, uint64_t>
+  {
+    return {a_.load(std::memory_order_relaxed), b_.load(std::memory_order_relaxed)};
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  Lock lock_{};
+
+  std::atomic_uint64_t a_{0};
+
+  std::atomic_uint64_t b_{0};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using LockTypes = ::testing::Types<OptimisticLock,
+                                   OptimisticLock32,
+                                   OptimisticLock16,
+                                   OptiQL,
+                                   PessimisticLock,
+                                   MCSLock>;
+TYPED_TEST_SUITE(OptimisticReadFixture, LockTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(OptimisticReadFixture, ReadWithoutWritersRunProcedureOnce)
+{
+  TestFixture::VerifyReadWithoutWriters();
+}
+
+TYPED_TEST(OptimisticReadFixture, ReadWithWritersReturnConsistentValues)
+{
+  TestFixture::VerifyReadWithWriters(kRetryNum);
+}
+
+TYPED_TEST(OptimisticReadFixture, ReadWithoutRetriesReturnConsistentValues)
+{
+  TestFixture::VerifyReadWithWriters(0);
+}
+
+}  // namespace dbgroup::lock::test
@@ -133,6 +133,20 @@ class PessimisticLockFixture : public ::testing::Test
     t_.join();
   }
 
+  void
+  VerifyUpgradedLockIsReleased()
+  {
+    {
+      auto &&x_guard = lock_.LockSIX().UpgradeToX();
+      EXPECT_TRUE(x_guard);
+    }
+
+    // the upgraded X lock must be released with its guard
+    TryLock(kXLock, kExpectSucceed);
+
+    t_.join();
+  }
+
   void
   VerifyLockSWithMultiThread()
   {
@@ -420,6 +434,13 @@ TEST_F(  //
   VerifyUpgradeToXWith(kSLock, kExpectFail);
 }
 
+TEST_F(  //
+    PessimisticLockFixture,
+    UpgradedXLockIsReleasedWithItsGuard)
+{
+  VerifyUpgradedLockIsReleased();
+}
+
 /*----------------------------------------------------------------------------*
  * Multi-thread tests
  *----------------------------------------------------------------------------*/
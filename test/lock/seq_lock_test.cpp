@@ -0,0 +1,214 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/seq_lock.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kWriteNumPerThread = 1E5;
+constexpr size_t kWordNum = 8;
+
+/*##############################################################################
+ * Global types
+ *############################################################################*/
+
+struct MultiWord {
+  std::array<uint64_t, kWordNum> words{};
+};
+
+template <bool kMultiWriter>
+class SeqLockFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Types
+   *##########################################################################*/
+
+  using SeqLock_t = SeqLock<MultiWord, kMultiWriter>;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyReadWrite()
+  {
+    EXPECT_EQ(lock_.GetVersion(), 0);
+    for (size_t i = 1; i <= kWordNum; ++i) {
+      lock_.Write(CreateValue(i));
+      EXPECT_EQ(lock_.GetVersion(), i);
+
+      const auto &val = lock_.Read();
+      for (const auto word : val.words) {
+        EXPECT_EQ(word, i);
+      }
+
+      MultiWord out{};
+      ASSERT_TRUE(lock_.TryRead(out));
+      EXPECT_EQ(out.words, val.words);
+    }
+  }
+
+  void
+  VerifyConsistentReads(  //
+      const size_t writer_num)
+  {
+    std::atomic_bool is_running{true};
+    std::vector<std::thread> readers{};
+    readers.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      readers.emplace_back([&]() {
+        while (is_running.load(std::memory_order_relaxed)) {
+          const auto &val = lock_.Read();
+          for (const auto word : val.words) {
+            ASSERT_EQ(word, val.words.front());
+          }
+        }
+      });
+    }
+
+    std::vector<std::thread> writers{};
+    writers.reserve(writer_num);
+    for (size_t i = 0; i < writer_num; ++i) {
+      writers.emplace_back([&, i]() {
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          lock_.Write(CreateValue(i * kWriteNumPerThread + j));
+        }
+      });
+    }
+    for (auto &&t : writers) {
+      t.join();
+    }
+
+    is_running.store(false, std::memory_order_relaxed);
+    for (auto &&t : readers) {
+      t.join();
+    }
+    EXPECT_EQ(lock_.GetVersion(), writer_num * kWriteNumPerThread);
+  }
+
+  void
+  VerifyConcurrentUpdates()
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([this]() {
+        for (size_t j = 0; j < kWriteNumPerThread; ++j) {
+          lock_.Update([](MultiWord &val) {
+            for (auto &&word : val.words) {
+              ++word;
+            }
+          });
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    const auto &val = lock_.Read();
+    for (const auto word : val.words) {
+      EXPECT_EQ(word, kThreadNum * kWriteNumPerThread);
+    }
+  }
+
+  /*############################################################################
+   * Internal utility functions
+   *##########################################################################*/
+
+  static auto
+  CreateValue(  //
+      const uint64_t v)  //
+      -> MultiWord
+  {
+    MultiWord val{};
+    val.words.fill(v);
+    return val;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  SeqLock_t lock_{};
+};
+
+using SingleWriterSeqLockFixture = SeqLockFixture<false>;
+using MultiWriterSeqLockFixture = SeqLockFixture<true>;
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(SingleWriterSeqLockFixture, ReadReturnWrittenValues)
+{
+  VerifyReadWrite();
+}
+
+TEST_F(SingleWriterSeqLockFixture, ReadNeverReturnTornValuesWithSingleWriter)
+{
+  VerifyConsistentReads(1);
+}
+
+TEST_F(MultiWriterSeqLockFixture, ReadReturnWrittenValues)
+{
+  VerifyReadWrite();
+}
+
+TEST_F(MultiWriterSeqLockFixture, ReadNeverReturnTornValuesWithMultipleWriters)
+{
+  VerifyConsistentReads(kThreadNum);
+}
+
+TEST_F(MultiWriterSeqLockFixture, UpdateByMultipleThreadsIsSerialized)
+{
+  VerifyConcurrentUpdates();
+}
+
+}  // namespace dbgroup::lock::test
@@ -0,0 +1,224 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/lock/ticket_lock.hpp"
+
+// C++ standard libraries
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::lock::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr bool kExpectSucceed = true;
+constexpr bool kExpectFail = false;
+constexpr size_t kWaiterNum = 8;
+constexpr size_t kWriteNumPerThread = 1E5;
+constexpr std::chrono::milliseconds kWaitTimeMill{100};
+constexpr std::chrono::milliseconds kArrivalInterval{10};
+
+/*##############################################################################
+ * Fixture definition
+ *############################################################################*/
+
+template <class Lock>
+class TicketLockFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyLockXWith(  //
+      const LockType lock_type,
+      const bool expected_rc)
+  {
+    {
+      typename Lock::XGuard guard{};
+      if (lock_type == kXLock) {
+        guard = lock_.LockX();
+        EXPECT_TRUE(guard);
+      }
+      TryLock(expected_rc);
+    }
+    t_.join();
+  }
+
+  void
+  VerifyFIFOOrder()
+  {
+    std::vector<size_t> order{};
+    std::vector<std::thread> threads{};
+    threads.reserve(kWaiterNum);
+
+    {  // make waiters arrive in order while holding the lock
+      auto &&x_guard = lock_.LockX();
+      for (size_t i = 0; i < kWaiterNum; ++i) {
+        threads.emplace_back([this, &order, i]() {
+          auto &&x_guard = lock_.LockX();
+          order.emplace_back(i);
+        });
+        std::this_thread::sleep_for(kArrivalInterval);
+      }
+    }
+
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    // the waiters must acquire the lock in their arrival order
+    ASSERT_EQ(order.size(), kWaiterNum);
+    for (size_t i = 0; i < kWaiterNum; ++i) {
+      EXPECT_EQ(order[i], i);
+    }
+  }
+
+  void
+  VerifyLockXWithMultiThread()
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+
+    {  // hold the lock to prevent a counter from modifying
+      auto &&x_guard = lock_.LockX();
+
+      // create incrementor threads
+      for (size_t i = 0; i < kThreadNum; ++i) {
+        threads.emplace_back([this]() {
+          for (size_t i = 0; i < kWriteNumPerThread; i++) {
+            auto &&x_guard = lock_.LockX();
+            ++counter_;
+          }
+        });
+      }
+
+      // after short sleep, check that the counter has not incremented
+      std::this_thread::sleep_for(kWaitTimeMill);
+      ASSERT_EQ(counter_, 0);
+    }
+
+    // release the lock, and then wait for the incrementors
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    // check the counter
+    auto &&x_guard = lock_.LockX();
+    ASSERT_EQ(counter_, kThreadNum * kWriteNumPerThread);
+  }
+
+  /*############################################################################
+   * Public utility functions
+   *##########################################################################*/
+
+  void
+  LockWorker(  //
+      std::promise<void> p)
+  {
+    [[maybe_unused]] const auto &guard = lock_.LockX();
+    p.set_value();
+  }
+
+  void
+  TryLock(  //
+      const bool expect_success)
+  {
+    // try to get an exclusive lock by another thread
+    std::promise<void> p{};
+    auto &&f = p.get_future();
+    t_ = std::thread{&TicketLockFixture::LockWorker, this, std::move(p)};
+
+    // after short sleep, give up on acquiring the lock
+    const auto rc = f.wait_for(kWaitTimeMill);
+
+    // verify status to check locking is succeeded
+    if (expect_success) {
+      ASSERT_EQ(rc, std::future_status::ready);
+    } else {
+      ASSERT_EQ(rc, std::future_status::timeout);
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  Lock lock_{};
+
+  size_t counter_{0};
+
+  std::thread t_{};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using LockTypes = ::testing::Types<TicketLock<1>, TicketLock<4>>;
+TYPED_TEST_SUITE(TicketLockFixture, LockTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(TicketLockFixture, LockXWithoutLocksSucceed)
+{
+  TestFixture::VerifyLockXWith(kFree, kExpectSucceed);
+}
+
+TYPED_TEST(TicketLockFixture, LockXAfterXLockNeedWait)
+{
+  TestFixture::VerifyLockXWith(kXLock, kExpectFail);
+}
+
+TYPED_TEST(TicketLockFixture, WaitersAcquireLockInArrivalOrder)
+{
+  TestFixture::VerifyFIFOOrder();
+}
+
+TYPED_TEST(TicketLockFixture, IncrementWithLockXKeepConsistentCounter)
+{
+  TestFixture::VerifyLockXWithMultiThread();
+}
+
+}  // namespace dbgroup::lock::test
@@ -0,0 +1,213 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/engine.hpp"
+
+// C++ standard libraries
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/random/common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRepeatNum = 1e6;
+constexpr size_t kStreamNum = 8;
+constexpr size_t kBinNum = 16;
+constexpr double kAllowableError = 0.01;
+
+template <class Engine>
+class EngineFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifySeed()
+  {
+    Engine g{kRandomSeed};
+    Engine same{kRandomSeed};
+    Engine other{kRandomSeed + 1};
+
+    size_t diff_num = 0;
+    std::vector<uint64_t> vals{};
+    for (size_t i = 0; i < kBinNum; ++i) {
+      const auto val = g();
+      EXPECT_EQ(same(), val);
+      diff_num += static_cast<size_t>(other() != val);
+      vals.emplace_back(val);
+    }
+    EXPECT_GT(diff_num, 0);
+
+    g.seed(kRandomSeed);
+    for (const auto val : vals) {
+      EXPECT_EQ(g(), val);
+    }
+  }
+
+  void
+  VerifyDiscard()
+  {
+    for (const size_t n : std::vector<size_t>{0, 1, 2, 3, 100, 1001}) {
+      for (const size_t pre : std::vector<size_t>{0, 1}) {
+        Engine g{kRandomSeed};
+        Engine skipped{kRandomSeed};
+        for (size_t i = 0; i < pre; ++i) {
+          g();
+          skipped();
+        }
+        for (size_t i = 0; i < n; ++i) {
+          g();
+        }
+        skipped.discard(n);
+        for (size_t i = 0; i < kBinNum; ++i) {
+          EXPECT_EQ(skipped(), g());
+        }
+      }
+    }
+  }
+
+  void
+  VerifyJump()
+  {
+    std::unordered_set<uint64_t> vals{};
+    Engine base{kRandomSeed};
+    for (size_t i = 0; i < kStreamNum; ++i) {
+      auto g = base;
+      for (size_t j = 0; j < kBinNum; ++j) {
+        vals.emplace(g());
+      }
+      base.Jump();
+    }
+    EXPECT_EQ(vals.size(), kStreamNum * kBinNum);
+  }
+
+  void
+  VerifyUniformity()
+  {
+    Engine g{kRandomSeed};
+    std::array<size_t, kBinNum> freq{};
+    for (size_t i = 0; i < kRepeatNum; ++i) {
+      const auto p = GenerateUnitDouble(g);
+      ASSERT_GE(p, 0.0);
+      ASSERT_LT(p, 1.0);
+      ++freq[static_cast<size_t>(p * kBinNum)];
+    }
+    for (const auto cnt : freq) {
+      EXPECT_NEAR(static_cast<double>(cnt) / kRepeatNum, 1.0 / kBinNum, kAllowableError);
+    }
+
+    // engines must be usable with standard distributions
+    std::uniform_int_distribution<size_t> dist{0, kBinNum - 1};
+    for (size_t i = 0; i < kBinNum; ++i) {
+      EXPECT_LT(dist(g), kBinNum);
+    }
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using Engines = ::testing::Types<SplitMix64, Xoshiro256StarStar, WyRand, Philox>;
+TYPED_TEST_SUITE(EngineFixture, Engines);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(EngineFixture, SameSeedsGenerateSameSequences)
+{
+  TestFixture::VerifySeed();
+}
+
+TYPED_TEST(EngineFixture, DiscardSkipsGivenNumberOfValues)
+{
+  TestFixture::VerifyDiscard();
+}
+
+TYPED_TEST(EngineFixture, JumpCreatesDisjointStreams)
+{
+  TestFixture::VerifyJump();
+}
+
+TYPED_TEST(EngineFixture, UnitDoublesAreUniform)
+{
+  TestFixture::VerifyUniformity();
+}
+
+/*##############################################################################
+ * Known answer tests
+ *############################################################################*/
+
+TEST(EngineTest, SplitMix64GeneratesReferenceValues)
+{
+  SplitMix64 g{1234567};
+  EXPECT_EQ(g(), 6457827717110365317UL);
+  EXPECT_EQ(g(), 3203168211198807973UL);
+  EXPECT_EQ(g(), 9817491932198370423UL);
+}
+
+TEST(EngineTest, Xoshiro256StarStarGeneratesReferenceValues)
+{
+  Xoshiro256StarStar g{std::array<uint64_t, 4>{1, 2, 3, 4}};
+  EXPECT_EQ(g(), 11520UL);
+  EXPECT_EQ(g(), 0UL);
+  EXPECT_EQ(g(), 1509978240UL);
+}
+
+TEST(EngineTest, PhiloxGeneratesReferenceValues)
+{
+  const auto &zero = Philox::Generate({0, 0}, 0);
+  EXPECT_EQ(zero[0], 0xCA00A0459843D731UL);
+  EXPECT_EQ(zero[1], 0x66C24222C9A845B5UL);
+
+  constexpr auto kMax = ~0UL;
+  const auto &ones = Philox::Generate({kMax, kMax}, kMax);
+  EXPECT_EQ(ones[0], 0x65B021D60CD8310FUL);
+  EXPECT_EQ(ones[1], 0x4D02F3222F86DF20UL);
+}
+
+}  // namespace dbgroup::random::test
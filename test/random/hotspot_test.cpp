@@ -0,0 +1,214 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/hotspot.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRepeatNum = 1e6;
+constexpr double kAllowableError = 0.01;
+constexpr double kHotFraction = 0.2;
+constexpr double kHotProb = 0.8;
+
+template <class IntType>
+class HotspotDistributionFixture : public ::testing::Test
+{
+  using Hotspot_t = HotspotDistribution<IntType>;
+  using Shifting_t = ShiftingHotspotDistribution<IntType>;
+
+ protected:
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr IntType kMin = 100;
+  static constexpr IntType kBinNum = 1000;
+  static constexpr IntType kMax = kMin + kBinNum - 1;
+  static constexpr IntType kHotNum = kBinNum * kHotFraction;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Utility functions
+   *##########################################################################*/
+
+  /**
+   * @param vals Generated values.
+   * @param hot_begin The first value of a hot set.
+   * @return The fraction of accesses to the hot set.
+   */
+  static auto
+  GetHotRatio(  //
+      const std::vector<IntType> &vals,
+      const IntType hot_begin)  //
+      -> double
+  {
+    size_t hot_cnt = 0;
+    for (const auto val : vals) {
+      EXPECT_GE(val, kMin);
+      EXPECT_LE(val, kMax);
+      const auto pos = (val - hot_begin + kBinNum) % kBinNum;
+      hot_cnt += static_cast<size_t>(pos < kHotNum);
+    }
+    return static_cast<double>(hot_cnt) / static_cast<double>(vals.size());
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyHotspot()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    const Hotspot_t hotspot{kMin, kMax, kHotFraction, kHotProb};
+    ASSERT_EQ(hotspot.GetHotNum(), kHotNum);
+
+    std::vector<IntType> vals(kRepeatNum);
+    hotspot.Fill(std::span{vals}, rand_engine);
+    for (size_t i = 1; i < kRepeatNum; i += 2) {
+      vals[i] = hotspot(rand_engine);
+    }
+    EXPECT_NEAR(GetHotRatio(vals, kMin), kHotProb, kAllowableError);
+
+    // values in each set are selected uniformly
+    std::vector<size_t> freq(kBinNum, 0);
+    for (const auto val : vals) {
+      ++freq[val - kMin];
+    }
+    const auto hot_expected = kRepeatNum * kHotProb / kHotNum;
+    const auto cold_expected = kRepeatNum * (1 - kHotProb) / (kBinNum - kHotNum);
+    for (IntType i = 0; i < kBinNum; ++i) {
+      const auto expected = i < kHotNum ? hot_expected : cold_expected;
+      EXPECT_NEAR(freq[i], expected, expected * 0.2);
+    }
+  }
+
+  void
+  VerifyShiftingHotspot()
+  {
+    constexpr double kDriftRate = 0.5;
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    const Shifting_t shifting{kMin, kMax, kHotFraction, kHotProb, kDriftRate};
+
+    for (const uint64_t step : {0UL, 100UL, 1999UL, 123456UL}) {
+      const auto hot_begin = shifting.GetHotBegin(step);
+      const auto expected = kMin + static_cast<IntType>(step * kDriftRate) % kBinNum;
+      ASSERT_EQ(hot_begin, expected);
+
+      std::vector<IntType> vals(kRepeatNum / 10);
+      shifting.Fill(std::span{vals}, rand_engine, step);
+      for (size_t i = 1; i < vals.size(); i += 2) {
+        vals[i] = shifting(rand_engine, step);
+      }
+      EXPECT_NEAR(GetHotRatio(vals, hot_begin), kHotProb, kAllowableError * 2);
+    }
+  }
+
+  void
+  VerifyInvalidParameters()
+  {
+    EXPECT_THROW((Hotspot_t{kMin, kMax, 0.0, kHotProb}), std::runtime_error);
+    EXPECT_THROW((Hotspot_t{kMin, kMax, kHotFraction, 1.5}), std::runtime_error);
+    EXPECT_THROW((Shifting_t{kMin, kMax, kHotFraction, kHotProb, -1.0}), std::runtime_error);
+
+    // the number of values in the whole 64-bit domain cannot be represented
+    constexpr auto kLimitMin = std::numeric_limits<IntType>::min();
+    constexpr auto kLimitMax = std::numeric_limits<IntType>::max();
+    if constexpr (sizeof(IntType) == sizeof(uint64_t)) {
+      EXPECT_THROW((Hotspot_t{kLimitMin, kLimitMax, kHotFraction, kHotProb}), std::runtime_error);
+      EXPECT_THROW((Shifting_t{kLimitMin, kLimitMax, kHotFraction, kHotProb, 1.0}),
+                   std::runtime_error);
+    }
+
+    // huge ranges wrap hot sets around without overflow
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    const auto huge_max = static_cast<IntType>(kLimitMax - 1);
+    const Shifting_t huge{kLimitMin, huge_max, 1.0, 1.0, 1.0};
+    for (size_t i = 0; i < kRepeatNum / 10; ++i) {
+      const auto val = huge(rand_engine, std::numeric_limits<uint64_t>::max() - i);
+      ASSERT_GE(val, kLimitMin);
+      ASSERT_LE(val, huge_max);
+    }
+
+    // a hot set covering all the values is uniform
+    const Hotspot_t uniform{kMin, kMax, 1.0, 0.0};
+    for (size_t i = 0; i < kRepeatNum / 10; ++i) {
+      const auto val = uniform(rand_engine);
+      ASSERT_GE(val, kMin);
+      ASSERT_LE(val, kMax);
+    }
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using IntegralTypes = ::testing::Types<int32_t, int64_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(HotspotDistributionFixture, IntegralTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(HotspotDistributionFixture, HotSetReceivesGivenFractionOfAccesses)
+{
+  TestFixture::VerifyHotspot();
+}
+
+TYPED_TEST(HotspotDistributionFixture, HotSetDriftsWithSteps)
+{
+  TestFixture::VerifyShiftingHotspot();
+}
+
+TYPED_TEST(HotspotDistributionFixture, InvalidParametersThrowException)
+{
+  TestFixture::VerifyInvalidParameters();
+}
+
+}  // namespace dbgroup::random::test
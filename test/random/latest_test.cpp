@@ -0,0 +1,149 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/latest.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <thread>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRepeatNum = 1e5;
+constexpr double kSkew = 1.0;
+constexpr size_t kThreadNum = 8;
+
+template <class IntType>
+class LatestDistributionFixture : public ::testing::Test
+{
+  using Latest_t = LatestDistribution<IntType>;
+
+ protected:
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr IntType kMin = 10;
+  static constexpr IntType kMax = 1009;
+  static constexpr IntType kWidth = kMax - kMin;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyMovingWindow()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    Latest_t latest{kMin, kMax, kSkew};
+
+    for (const IntType max : {kMax, static_cast<IntType>(kMax * 2), static_cast<IntType>(kMax * 5)}) {
+      latest.Update(max);
+      latest.Update(kMin);  // smaller values are ignored
+      ASSERT_EQ(latest.GetMax(), max);
+
+      std::vector<IntType> vals(kRepeatNum);
+      latest.Fill(std::span{vals}, rand_engine);
+      size_t max_cnt = 0;
+      size_t prev_cnt = 0;
+      for (size_t i = 0; i < kRepeatNum; ++i) {
+        const auto val = i % 2 == 0 ? vals[i] : latest(rand_engine);
+        ASSERT_LE(val, max);
+        ASSERT_GE(val, max - kWidth);
+        max_cnt += static_cast<size_t>(val == max);
+        prev_cnt += static_cast<size_t>(val == max - 1);
+      }
+
+      // the latest value is the hottest one
+      EXPECT_GT(max_cnt, prev_cnt);
+      EXPECT_GT(max_cnt, kRepeatNum / 10);
+    }
+  }
+
+  void
+  VerifyConcurrentUpdates()
+  {
+    Latest_t latest{kMin, kMax, kSkew};
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      threads.emplace_back([&, t] {
+        for (size_t i = t; i < kRepeatNum; i += kThreadNum) {
+          latest.Update(static_cast<IntType>(kMax + i));
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+    EXPECT_EQ(latest.GetMax(), static_cast<IntType>(kMax + kRepeatNum - 1));
+
+    // copies have the same maximum value
+    const auto copied = latest;
+    EXPECT_EQ(copied.GetMax(), latest.GetMax());
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using IntegralTypes = ::testing::Types<int32_t, int64_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(LatestDistributionFixture, IntegralTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(LatestDistributionFixture, GeneratedValuesFollowMovingMaximum)
+{
+  TestFixture::VerifyMovingWindow();
+}
+
+TYPED_TEST(LatestDistributionFixture, ConcurrentUpdatesKeepLargestValue)
+{
+  TestFixture::VerifyConcurrentUpdates();
+}
+
+}  // namespace dbgroup::random::test
@@ -0,0 +1,212 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/permutation.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kThreadNum = 7;
+
+template <class IntType>
+class PermutationFixture : public ::testing::Test
+{
+  using Permutation_t = Permutation<IntType>;
+
+ protected:
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr IntType kMaxBinNum = 70000;
+  static constexpr IntType kMin = std::numeric_limits<IntType>::min();
+  static constexpr IntType kMax = std::numeric_limits<IntType>::max() - kMaxBinNum;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyBijection()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::uniform_int_distribution<IntType> uniform_dist{kMin, kMax};
+
+    for (const size_t bin_num : std::vector<size_t>{1UL, 2UL, 3UL, 1000UL, 1024UL, 1025UL, kMaxBinNum}) {
+      const auto min = uniform_dist(rand_engine);
+      const auto max = static_cast<IntType>(min + static_cast<IntType>(bin_num - 1));
+      const Permutation_t perm{min, max, rand_engine()};
+      ASSERT_EQ(perm.GetSize(), bin_num);
+
+      std::vector<bool> used(bin_num, false);
+      size_t fixed_num = 0;
+      for (uint64_t i = 0; i < bin_num; ++i) {
+        const auto val = perm[i];
+        ASSERT_GE(val, min);
+        ASSERT_LE(val, max);
+        const auto offset = static_cast<uint64_t>(val) - static_cast<uint64_t>(min);
+        EXPECT_FALSE(used[offset]);
+        used[offset] = true;
+        EXPECT_EQ(perm.Inverse(val), i);
+        fixed_num += static_cast<size_t>(offset == i);
+      }
+      if (bin_num >= 1000) {
+        EXPECT_LT(fixed_num, bin_num / 100);  // values are shuffled
+      }
+    }
+  }
+
+  void
+  VerifyPartitions()
+  {
+    constexpr IntType kBinNum = 10007;
+    const Permutation_t perm{0, kBinNum - 1, kRandomSeed};
+
+    std::vector<bool> used(kBinNum, false);
+    uint64_t next_begin = 0;
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      const auto [begin, end] = perm.GetPartition(t, kThreadNum);
+      ASSERT_EQ(begin, next_begin);
+      ASSERT_LE(end - begin, kBinNum / kThreadNum + 1);
+      next_begin = end;
+
+      std::vector<IntType> vals(end - begin);
+      perm.Fill(std::span{vals}, begin);
+      for (uint64_t i = begin; i < end; ++i) {
+        const auto val = vals[i - begin];
+        ASSERT_EQ(val, perm[i]);
+        EXPECT_FALSE(used[val]);
+        used[val] = true;
+      }
+    }
+    EXPECT_EQ(next_begin, kBinNum);
+  }
+
+  void
+  VerifyFullRange()
+  {
+    constexpr auto kLimitMin = std::numeric_limits<IntType>::min();
+    constexpr auto kLimitMax = std::numeric_limits<IntType>::max();
+    constexpr uint64_t kIndexNum = 1000;
+    const Permutation_t perm{kLimitMin, kLimitMax, kRandomSeed};
+
+    // the size of the 64-bit domain wraps around to zero
+    const auto size = static_cast<uint64_t>(kLimitMax) - static_cast<uint64_t>(kLimitMin) + 1;
+    EXPECT_EQ(perm.GetSize(), size);
+
+    std::set<IntType> vals{};
+    for (uint64_t i = 0; i < kIndexNum; ++i) {
+      const auto val = perm[i];
+      EXPECT_TRUE(vals.insert(val).second);
+      EXPECT_EQ(perm.Inverse(val), i);
+    }
+    EXPECT_EQ(perm[perm.Inverse(kLimitMax)], kLimitMax);
+    EXPECT_EQ(perm[perm.Inverse(kLimitMin)], kLimitMin);
+
+    // partitions are contiguous and cover the whole domain
+    uint64_t next_begin = 0;
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      const auto [begin, end] = perm.GetPartition(t, kThreadNum);
+      ASSERT_EQ(begin, next_begin);
+      next_begin = end;
+    }
+    EXPECT_EQ(next_begin, perm.GetSize());
+  }
+
+  void
+  VerifySeeds()
+  {
+    constexpr IntType kBinNum = 1000;
+    const Permutation_t perm{0, kBinNum - 1, kRandomSeed};
+    const Permutation_t same{0, kBinNum - 1, kRandomSeed};
+    const Permutation_t other{0, kBinNum - 1, kRandomSeed + 1};
+
+    size_t diff_num = 0;
+    for (uint64_t i = 0; i < kBinNum; ++i) {
+      EXPECT_EQ(perm[i], same[i]);
+      diff_num += static_cast<size_t>(perm[i] != other[i]);
+    }
+    EXPECT_GT(diff_num, kBinNum / 2);
+
+    EXPECT_THROW((Permutation_t{1, 0}), std::runtime_error);
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using IntegralTypes = ::testing::Types<int32_t, int64_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(PermutationFixture, IntegralTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(PermutationFixture, IndicesAreMappedIntoUniqueValues)
+{
+  TestFixture::VerifyBijection();
+}
+
+TYPED_TEST(PermutationFixture, PartitionsAreDisjointAndCoverAllIndices)
+{
+  TestFixture::VerifyPartitions();
+}
+
+TYPED_TEST(PermutationFixture, FullRangePermutationsDoNotLoopForever)
+{
+  TestFixture::VerifyFullRange();
+}
+
+TYPED_TEST(PermutationFixture, SameSeedsGenerateSamePermutations)
+{
+  TestFixture::VerifySeeds();
+}
+
+}  // namespace dbgroup::random::test
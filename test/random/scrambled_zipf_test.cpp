@@ -0,0 +1,175 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/scrambled_zipf.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRepeatNum = 1e6;
+constexpr double kAllowableError = 0.01;
+constexpr double kSkew = 1.0;
+constexpr size_t kHotNum = 10;
+
+template <class IntType>
+class ScrambledZipfDistributionFixture : public ::testing::Test
+{
+  using ScrambledZipf_t = ScrambledZipfDistribution<IntType>;
+
+ protected:
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr IntType kBinNum = 1000;
+  static constexpr IntType kMaxBinNum = 70000;
+  static constexpr IntType kMin = std::numeric_limits<IntType>::min();
+  static constexpr IntType kMax = std::numeric_limits<IntType>::max() - kMaxBinNum;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyBijection()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::uniform_int_distribution<IntType> uniform_dist{kMin, kMax};
+
+    for (const size_t bin_num : std::vector<size_t>{1UL, 2UL, 3UL, 1000UL, 1024UL, 1025UL, kMaxBinNum}) {
+      const auto min = uniform_dist(rand_engine);
+      const auto max = static_cast<IntType>(min + static_cast<IntType>(bin_num - 1));
+      const ScrambledZipf_t zipf{min, max, 0.0, rand_engine()};
+
+      std::vector<bool> used(bin_num, false);
+      for (uint64_t rank = 0; rank < bin_num; ++rank) {
+        const auto val = zipf.GetValue(rank);
+        ASSERT_GE(val, min);
+        ASSERT_LE(val, max);
+        const auto offset = static_cast<uint64_t>(val) - static_cast<uint64_t>(min);
+        EXPECT_FALSE(used[offset]);
+        used[offset] = true;
+        EXPECT_EQ(zipf.GetRank(val), rank);
+      }
+    }
+  }
+
+  void
+  VerifyZipfLaw()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::uniform_int_distribution<IntType> uniform_dist{kMin, kMax};
+    const auto min = uniform_dist(rand_engine);
+    const auto max = static_cast<IntType>(min + kBinNum - 1);
+    const ScrambledZipf_t zipf{min, max, kSkew, kRandomSeed};
+
+    // count rank frequency
+    std::vector<IntType> generated_ids(kRepeatNum);
+    zipf.Fill(std::span{generated_ids}, rand_engine);
+    std::vector<size_t> freq_dist(kBinNum, 0);
+    for (size_t i = 0; i < kRepeatNum; ++i) {
+      const auto id = i % 2 == 0 ? generated_ids[i] : zipf(rand_engine);
+      ASSERT_GE(id, min);
+      ASSERT_LE(id, max);
+      ++freq_dist[zipf.GetRank(id)];
+    }
+
+    // check rank frequency approximately equals to Zipf's law
+    const auto base_prob = static_cast<double>(freq_dist[0]) / kRepeatNum;
+    for (size_t k = 2; k <= kBinNum; ++k) {
+      const auto kth_prob = static_cast<double>(freq_dist[k - 1]) / kRepeatNum;
+      EXPECT_NEAR(kth_prob, base_prob / std::pow(static_cast<double>(k), kSkew), kAllowableError);
+    }
+  }
+
+  void
+  VerifyScatteredHotValues()
+  {
+    const ScrambledZipf_t zipf{0, kBinNum - 1, kSkew, kRandomSeed};
+    const ScrambledZipf_t other{0, kBinNum - 1, kSkew, kRandomSeed + 1};
+
+    std::vector<IntType> hot_vals{};
+    size_t same_num = 0;
+    for (size_t rank = 0; rank < kHotNum; ++rank) {
+      hot_vals.emplace_back(zipf.GetValue(rank));
+      same_num += static_cast<size_t>(zipf.GetValue(rank) == other.GetValue(rank));
+    }
+    const auto [min_it, max_it] = std::minmax_element(hot_vals.begin(), hot_vals.end());
+    EXPECT_GT(*max_it - *min_it, kBinNum / 2);
+    EXPECT_LT(same_num, kHotNum);
+  }
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using IntegralTypes = ::testing::Types<int32_t, int64_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(ScrambledZipfDistributionFixture, IntegralTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(ScrambledZipfDistributionFixture, GetValueAndGetRankAreInverseBijections)
+{
+  TestFixture::VerifyBijection();
+}
+
+TYPED_TEST(ScrambledZipfDistributionFixture, GeneratedRanksObeyZipfLaw)
+{
+  TestFixture::VerifyZipfLaw();
+}
+
+TYPED_TEST(ScrambledZipfDistributionFixture, HotValuesAreScatteredBySeeds)
+{
+  TestFixture::VerifyScatteredHotValues();
+}
+
+}  // namespace dbgroup::random::test
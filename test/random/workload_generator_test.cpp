@@ -0,0 +1,314 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dbgroup/random/workload_generator.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::random::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kRepeatNum = 1e5;
+constexpr size_t kRecordNum = 10000;
+constexpr size_t kThreadNum = 4;
+constexpr double kAllowableError = 0.01;
+
+class WorkloadGeneratorFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Utility functions
+   *##########################################################################*/
+
+  static auto
+  Generate(  //
+      WorkloadGenerator &gen,
+      const size_t thread_id)  //
+      -> std::vector<Operation>
+  {
+    std::vector<Operation> ops(kRepeatNum);
+    gen.Fill(thread_id, std::span{ops});
+    return ops;
+  }
+
+  /*############################################################################
+   * Functions for verification
+   *##########################################################################*/
+
+  void
+  VerifyYCSB(  //
+      const char type)
+  {
+    const auto &config = WorkloadConfig::YCSB(type, kRecordNum);
+    WorkloadGenerator gen{config, kThreadNum, kRandomSeed};
+
+    std::array<size_t, 5> freq{};
+    uint64_t max_insert_key = kRecordNum - 1;
+    uint64_t max_existing_key = 0;
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      for (const auto &op : Generate(gen, t)) {
+        ++freq[static_cast<size_t>(op.type)];
+        if (op.type == OpType::kScan) {
+          ASSERT_GE(op.len, 1);
+          ASSERT_LE(op.len, config.max_scan_length);
+        } else {
+          ASSERT_EQ(op.len, config.min_value_size);
+        }
+        if (op.type == OpType::kInsert) {
+          ASSERT_GE(op.key, kRecordNum);
+          ASSERT_EQ((op.key - kRecordNum) % kThreadNum, t);
+          max_insert_key = std::max(max_insert_key, op.key);
+        } else {
+          max_existing_key = std::max(max_existing_key, op.key);
+        }
+      }
+    }
+    EXPECT_LE(max_existing_key, max_insert_key);
+
+    const auto &mix = config.mix;
+    const std::array expected{mix.read, mix.update, mix.insert, mix.scan, mix.read_modify_write};
+    for (size_t i = 0; i < freq.size(); ++i) {
+      const auto actual = static_cast<double>(freq[i]) / (kRepeatNum * kThreadNum);
+      EXPECT_NEAR(actual, expected[i], kAllowableError);
+    }
+  }
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(WorkloadGeneratorFixture, YCSBWorkloadsFollowTheirOperationMixes)
+{
+  for (const auto type : {'A', 'B', 'C', 'D', 'E', 'F'}) {
+    VerifyYCSB(type);
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, YCSBWorkloadsUseTheirKeyDistributions)
+{
+  for (const auto type : {'A', 'B', 'C', 'E', 'F'}) {
+    EXPECT_EQ(WorkloadConfig::YCSB(type).key_dist, KeyDistribution::kScrambledZipf);
+  }
+  EXPECT_EQ(WorkloadConfig::YCSB('D').key_dist, KeyDistribution::kLatest);
+}
+
+TEST_F(WorkloadGeneratorFixture, UnknownYCSBWorkloadThrowsException)
+{
+  EXPECT_THROW(std::ignore = WorkloadConfig::YCSB('G'), std::runtime_error);
+}
+
+TEST_F(WorkloadGeneratorFixture, SameSeedsGenerateSameStreams)
+{
+  const auto &config = WorkloadConfig::YCSB('A', kRecordNum);
+  WorkloadGenerator gen{config, kThreadNum, kRandomSeed};
+  WorkloadGenerator same{config, kThreadNum, kRandomSeed};
+
+  // generate the streams in different orders
+  const auto &first = Generate(gen, 0);
+  const auto &second = Generate(gen, 1);
+  const auto &same_second = Generate(same, 1);
+  const auto &same_first = Generate(same, 0);
+
+  size_t diff_num = 0;
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    EXPECT_EQ(first[i].type, same_first[i].type);
+    EXPECT_EQ(first[i].key, same_first[i].key);
+    EXPECT_EQ(second[i].key, same_second[i].key);
+    diff_num += static_cast<size_t>(first[i].key != second[i].key);
+  }
+  EXPECT_GT(diff_num, kRepeatNum / 2);
+
+  // operator-wise generation is equivalent to batch generation
+  WorkloadGenerator next{config, kThreadNum, kRandomSeed};
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    const auto &op = next.Next(0);
+    EXPECT_EQ(op.type, first[i].type);
+    EXPECT_EQ(op.key, first[i].key);
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, InsertKeysAreUniqueAcrossThreads)
+{
+  const WorkloadConfig config{.mix = {.insert = 1.0}, .record_num = kRecordNum};
+  WorkloadGenerator gen{config, kThreadNum, kRandomSeed};
+
+  std::unordered_set<uint64_t> keys{};
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    for (const auto &op : Generate(gen, t)) {
+      ASSERT_EQ(op.type, OpType::kInsert);
+      EXPECT_TRUE(keys.emplace(op.key).second);
+    }
+    EXPECT_EQ(gen.GetInsertedNum(t), kRepeatNum);
+  }
+  EXPECT_EQ(*std::max_element(keys.begin(), keys.end()), kRecordNum + kRepeatNum * kThreadNum - 1);
+}
+
+TEST_F(WorkloadGeneratorFixture, LatestStreamsReadOnlyVisibleKeys)
+{
+  const auto &config = WorkloadConfig::YCSB('D', kRecordNum);
+  WorkloadGenerator gen{config, kThreadNum, kRandomSeed};
+  WorkloadGenerator same{config, kThreadNum, kRandomSeed};
+
+  // interleave the streams in different orders
+  std::vector<std::vector<Operation>> ops(kThreadNum);
+  std::vector<std::vector<Operation>> same_ops(kThreadNum);
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    for (size_t t = 0; t < kThreadNum; ++t) {
+      ops[t].emplace_back(gen.Next(t));
+    }
+  }
+  for (size_t t = kThreadNum; t > 0; --t) {
+    same_ops[t - 1] = Generate(same, t - 1);
+  }
+
+  for (size_t t = 0; t < kThreadNum; ++t) {
+    std::unordered_set<uint64_t> inserted{};
+    size_t new_cnt = 0;
+    for (size_t i = 0; i < kRepeatNum; ++i) {
+      const auto &op = ops[t][i];
+      EXPECT_EQ(op.type, same_ops[t][i].type);
+      EXPECT_EQ(op.key, same_ops[t][i].key);
+      if (op.type == OpType::kInsert) {
+        inserted.emplace(op.key);
+      } else if (op.key >= kRecordNum) {
+        ASSERT_TRUE(inserted.contains(op.key));
+        ++new_cnt;
+      }
+    }
+    EXPECT_GT(new_cnt, 0);
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, KeyDistributionsSelectExistingKeys)
+{
+  for (const auto dist : {KeyDistribution::kUniform, KeyDistribution::kZipf,
+                          KeyDistribution::kScrambledZipf}) {
+    const WorkloadConfig config{.record_num = kRecordNum, .key_dist = dist};
+    WorkloadGenerator gen{config, 1, kRandomSeed};
+
+    std::vector<size_t> freq(kRecordNum, 0);
+    for (const auto &op : Generate(gen, 0)) {
+      ASSERT_LT(op.key, kRecordNum);
+      ++freq[op.key];
+    }
+    const auto hottest = *std::max_element(freq.begin(), freq.end());
+    if (dist == KeyDistribution::kUniform) {
+      EXPECT_LT(hottest, kRepeatNum / 100);
+    } else {
+      EXPECT_GT(hottest, kRepeatNum / 100);
+      EXPECT_EQ(freq[0] == hottest, dist == KeyDistribution::kZipf);
+    }
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, HotspotDistributionsConcentrateOnHotKeys)
+{
+  for (const auto dist : {KeyDistribution::kHotspot, KeyDistribution::kShiftingHotspot}) {
+    const WorkloadConfig config{.record_num = kRecordNum, .key_dist = dist, .drift_rate = 1.0};
+    WorkloadGenerator gen{config, 1, kRandomSeed};
+
+    size_t hot_cnt = 0;
+    for (const auto &op : Generate(gen, 0)) {
+      ASSERT_LT(op.key, kRecordNum);
+      hot_cnt += static_cast<size_t>(op.key < kRecordNum * config.hot_fraction);
+    }
+    const auto hot_ratio = static_cast<double>(hot_cnt) / kRepeatNum;
+    if (dist == KeyDistribution::kHotspot) {
+      EXPECT_NEAR(hot_ratio, config.hot_prob, kAllowableError);
+    } else {
+      // the hot set has drifted over all the keys
+      EXPECT_LT(hot_ratio, config.hot_prob / 2);
+    }
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, ValueSizesAndScanLengthsAreWithinRanges)
+{
+  constexpr uint32_t kMinSize = 8;
+  constexpr uint32_t kMaxSize = 64;
+  constexpr uint32_t kMaxLen = 10;
+  for (const auto dist : {LengthDistribution::kUniform, LengthDistribution::kZipf}) {
+    const WorkloadConfig config{
+        .mix = {.update = 0.5, .scan = 0.5},
+        .record_num = kRecordNum,
+        .min_value_size = kMinSize,
+        .max_value_size = kMaxSize,
+        .scan_dist = dist,
+        .max_scan_length = kMaxLen,
+    };
+    WorkloadGenerator gen{config, 1, kRandomSeed};
+
+    std::vector<size_t> len_freq(kMaxLen + 1, 0);
+    std::unordered_set<uint32_t> sizes{};
+    for (const auto &op : Generate(gen, 0)) {
+      if (op.type == OpType::kScan) {
+        ASSERT_GE(op.len, 1);
+        ASSERT_LE(op.len, kMaxLen);
+        ++len_freq[op.len];
+      } else {
+        ASSERT_GE(op.len, kMinSize);
+        ASSERT_LE(op.len, kMaxSize);
+        sizes.emplace(op.len);
+      }
+    }
+    EXPECT_EQ(sizes.size(), kMaxSize - kMinSize + 1);
+    if (dist == LengthDistribution::kZipf) {
+      EXPECT_GT(len_freq[1], len_freq[kMaxLen] * 2);
+    }
+  }
+}
+
+TEST_F(WorkloadGeneratorFixture, InvalidConfigurationsThrowException)
+{
+  EXPECT_THROW((WorkloadGenerator{WorkloadConfig{.record_num = 0}}), std::runtime_error);
+  EXPECT_THROW((WorkloadGenerator{WorkloadConfig{.mix = {}}}), std::runtime_error);
+  EXPECT_THROW((WorkloadGenerator{WorkloadConfig{}, 0}), std::runtime_error);
+}
+
+}  // namespace dbgroup::random::test
@@ -16,10 +16,19 @@
 
 #include "dbgroup/random/zipf.hpp"
 
+// system libraries
+#include <unistd.h>
+
 // C++ standard libraries
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
 #include <thread>
+#include <stdexcept>
 #include <type_traits>
 #include <vector>
 
@@ -46,6 +55,7 @@ class ZipfDistributionFixture : public ::testing::Test
 {
   using ZipfDist_t = ZipfDistribution<IntType>;
   using ApproxZipf_t = ApproxZipfDistribution<IntType>;
+  using AliasZipf_t = AliasZipfDistribution<IntType>;
 
  protected:
   /*############################################################################
@@ -190,6 +200,209 @@ class ZipfDistributionFixture : public ::testing::Test
     }
   }
 
+  void
+  VerifyLargeKeySpace()
+  {
+    constexpr std::array<IntType, 5> kCheckPoints{0, 65535, 70000, 70031, kLargeBinNum - 2};
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::vector<IntType> generated_ids(kRepeatNum);
+
+    for (size_t i = 0; i <= kMaxAlphaUL; i += 5) {
+      const auto alpha = static_cast<double>(i) / static_cast<double>(kAlphaUnitUL);
+      const ZipfDist_t zipf{0, kLargeBinNum - 1, alpha};
+      EXPECT_DOUBLE_EQ(zipf.GetCDF(kLargeBinNum - 1), 1.0);
+
+      // compute exact CDF values
+      std::vector<double> expected_cdf{};
+      auto sum = 0.0;
+      for (IntType k = 0; k < kLargeBinNum; ++k) {
+        sum += 1.0 / std::pow(static_cast<double>(k + 1), alpha);
+        if (std::find(kCheckPoints.begin(), kCheckPoints.end(), k) != kCheckPoints.end()) {
+          expected_cdf.emplace_back(sum);
+        }
+      }
+      for (auto &&cdf : expected_cdf) {
+        cdf /= sum;
+      }
+
+      // check stored CDF values and generated IDs
+      zipf.Fill(std::span{generated_ids}, rand_engine);
+      std::sort(generated_ids.begin(), generated_ids.end());
+      for (size_t j = 0; j < kCheckPoints.size(); ++j) {
+        const auto id = kCheckPoints[j];
+        EXPECT_NEAR(zipf.GetCDF(id), expected_cdf[j], 1e-9);
+
+        const auto &it = std::upper_bound(generated_ids.begin(), generated_ids.end(), id);
+        const auto actual = static_cast<double>(it - generated_ids.begin()) / kRepeatNum;
+        EXPECT_NEAR(actual, expected_cdf[j], kAllowableError);
+      }
+      EXPECT_LT(generated_ids.back(), kLargeBinNum);
+    }
+  }
+
+  void
+  VerifyParallelAndCachedConstruction()
+  {
+    constexpr size_t kThreadNum = 4;
+    constexpr double kAlpha = 1.0;
+    const auto &cache_dir = std::filesystem::temp_directory_path()
+                            / ("cpp_utility_zipf_test_" + std::to_string(::getpid()));
+    std::filesystem::create_directories(cache_dir);
+
+    const ZipfDist_t zipf{0, kLargeBinNum - 1, kAlpha};
+    const ZipfDist_t parallel{0, kLargeBinNum - 1, kAlpha, kThreadNum};
+    const ZipfDist_t stored{0, kLargeBinNum - 1, kAlpha, kThreadNum, cache_dir};
+    EXPECT_FALSE(std::filesystem::is_empty(cache_dir));
+    const ZipfDist_t loaded{0, kLargeBinNum - 1, kAlpha, kThreadNum, cache_dir};
+    for (IntType id = 0; id < kLargeBinNum; id += kSmallBinNum - 1) {
+      const auto cdf = zipf.GetCDF(id);
+      EXPECT_NEAR(parallel.GetCDF(id), cdf, 1e-12);
+      EXPECT_DOUBLE_EQ(stored.GetCDF(id), parallel.GetCDF(id));
+      EXPECT_DOUBLE_EQ(loaded.GetCDF(id), parallel.GetCDF(id));
+    }
+
+    const auto &orig = RunZipfEngine(stored, 0, kLargeBinNum - 1, kRandomSeed);
+    const auto &copied = RunZipfEngine(loaded, 0, kLargeBinNum - 1, kRandomSeed);
+    EXPECT_TRUE(std::equal(orig.begin(), orig.end(), copied.begin(), copied.end()));
+
+    std::filesystem::remove_all(cache_dir);
+  }
+
+  void
+  VerifyTamperedCacheRejection()
+  {
+    constexpr double kAlpha = 1.0;
+    constexpr size_t kCDFNumOffset = 32;  // the offset of the number of CDF values
+    const auto &cache_dir = std::filesystem::temp_directory_path()
+                            / ("cpp_utility_zipf_tampered_" + std::to_string(::getpid()));
+    std::filesystem::create_directories(cache_dir);
+
+    const ZipfDist_t zipf{0, kLargeBinNum - 1, kAlpha};
+    const ZipfDist_t stored{0, kLargeBinNum - 1, kAlpha, 1, cache_dir};
+    const auto path = std::filesystem::directory_iterator{cache_dir}->path();
+
+    // drop the last CDF value and make the header consistent with the file size
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - sizeof(double));
+    uint64_t cdf_num{};
+    {
+      std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+      file.seekg(kCDFNumOffset);
+      file.read(reinterpret_cast<char *>(&cdf_num), sizeof(uint64_t));  // NOLINT
+      --cdf_num;
+      file.seekp(kCDFNumOffset);
+      file.write(reinterpret_cast<const char *>(&cdf_num), sizeof(uint64_t));  // NOLINT
+      ASSERT_TRUE(file.good());
+    }
+
+    // the tampered file is rejected and replaced with a valid one
+    const ZipfDist_t loaded{0, kLargeBinNum - 1, kAlpha, 1, cache_dir};
+    EXPECT_EQ(std::filesystem::file_size(path), size);
+    for (IntType id = 0; id < kLargeBinNum; id += kSmallBinNum - 1) {
+      EXPECT_DOUBLE_EQ(loaded.GetCDF(id), zipf.GetCDF(id));
+    }
+    EXPECT_DOUBLE_EQ(loaded.GetCDF(kLargeBinNum - 1), 1.0);
+
+    std::filesystem::remove_all(cache_dir);
+  }
+
+  void
+  VerifyExtendRange()
+  {
+    constexpr double kAlpha = 1.0;
+    constexpr std::array<IntType, 4> kMaxes{99, 150, 70000, kLargeBinNum - 1};
+    ZipfDist_t zipf{0, 49, kAlpha};
+    ApproxZipf_t approx_zipf{0, 49, kAlpha};
+
+    IntType prev_max = 49;
+    for (const auto max : kMaxes) {
+      const auto prev = zipf;  // the CDF must be copied before extension
+      zipf.ExtendRange(max);
+      approx_zipf.ExtendRange(max);
+      EXPECT_DOUBLE_EQ(prev.GetCDF(prev_max), 1.0);
+      EXPECT_LT(prev.GetCDF(prev_max - 1), 1.0);
+      prev_max = max;
+      EXPECT_DOUBLE_EQ(zipf.GetCDF(max), 1.0);
+
+      // extended distributions are the same as reconstructed ones
+      const ZipfDist_t expected{0, max, kAlpha};
+      const ApproxZipf_t expected_approx{0, max, kAlpha};
+      for (IntType id = 0; id <= max; id += std::max<IntType>(max / kSmallBinNum, 1)) {
+        EXPECT_NEAR(zipf.GetCDF(id), expected.GetCDF(id), 1e-12);
+        EXPECT_DOUBLE_EQ(approx_zipf.GetCDF(id), expected_approx.GetCDF(id));
+      }
+      std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+      for (size_t i = 0; i < kSmallBinNum; ++i) {
+        EXPECT_LE(zipf(rand_engine), max);
+        EXPECT_LE(approx_zipf(rand_engine), max);
+      }
+    }
+
+    EXPECT_THROW(zipf.ExtendRange(0), std::runtime_error);
+    EXPECT_THROW(approx_zipf.ExtendRange(0), std::runtime_error);
+  }
+
+  void
+  VerifyAliasZipf()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::uniform_int_distribution<IntType> uniform_dist{kMin, kMax};
+
+    {  // an empty distribution always generates zero
+      AliasZipf_t alias_zipf{};
+      for (size_t i = 0; i < kSmallBinNum; ++i) {
+        EXPECT_EQ(alias_zipf(rand_engine), 0);
+      }
+    }
+
+    for (size_t i = 0; i <= kMaxAlphaUL; ++i) {
+      const auto min = uniform_dist(rand_engine);
+      const auto max = min + kSmallBinNum - 1;
+      const auto alpha = static_cast<double>(i) / static_cast<double>(kAlphaUnitUL);
+      const AliasZipf_t alias_zipf{min, max, alpha};
+
+      std::vector<IntType> generated_ids;
+      generated_ids.reserve(kRepeatNum);
+      for (size_t j = 0; j < kRepeatNum; ++j) {
+        const auto id = alias_zipf(rand_engine);
+        generated_ids.emplace_back(id);
+
+        EXPECT_GE(id, min);
+        EXPECT_LE(id, max);
+      }
+      CheckGeneratedIDsObeyZipfLaw(generated_ids, min, alpha);
+    }
+  }
+
+  void
+  VerifyFill()
+  {
+    std::mt19937_64 rand_engine{kRandomSeed};  // NOLINT
+    std::uniform_int_distribution<IntType> uniform_dist{kMin, kMax};
+    std::vector<IntType> generated_ids(kRepeatNum);
+
+    for (size_t i = 0; i <= kMaxAlphaUL; ++i) {
+      const auto min = uniform_dist(rand_engine);
+      const auto max = min + kSmallBinNum - 1;
+      const auto alpha = static_cast<double>(i) / static_cast<double>(kAlphaUnitUL);
+
+      const ZipfDist_t zipf{min, max, alpha};
+      zipf.Fill(std::span{generated_ids}, rand_engine);
+      CheckGeneratedIDsObeyZipfLaw(generated_ids, min, alpha);
+
+      const AliasZipf_t alias_zipf{min, max, alpha};
+      alias_zipf.Fill(std::span{generated_ids}, rand_engine);
+      CheckGeneratedIDsObeyZipfLaw(generated_ids, min, alpha);
+
+      const ApproxZipf_t approx_zipf{min, max, alpha};
+      approx_zipf.Fill(std::span{generated_ids}, rand_engine);
+      for (const auto id : generated_ids) {
+        EXPECT_GE(id, min);
+        EXPECT_LE(id, max);
+      }
+    }
+  }
+
   /*############################################################################
    * Public utility functions
    *##########################################################################*/
@@ -275,6 +488,26 @@ TYPED_TEST(ZipfDistributionFixture, MovedInstanceGenerateSameIDs)
   TestFixture::VerifyMoveInitializers();
 }
 
+TYPED_TEST(ZipfDistributionFixture, ConstructWithLargeKeySpaceGenerateCorrectSkewValues)
+{
+  TestFixture::VerifyLargeKeySpace();
+}
+
+TYPED_TEST(ZipfDistributionFixture, ConstructWithThreadsAndCacheGenerateSameCDF)
+{
+  TestFixture::VerifyParallelAndCachedConstruction();
+}
+
+TYPED_TEST(ZipfDistributionFixture, ConstructWithTamperedCacheRecomputeCDF)
+{
+  TestFixture::VerifyTamperedCacheRejection();
+}
+
+TYPED_TEST(ZipfDistributionFixture, ExtendRangeGenerateSameCDFAsReconstruction)
+{
+  TestFixture::VerifyExtendRange();
+}
+
 /*------------------------------------------------------------------------------
  * Approximate Zipf distribution tests
  *----------------------------------------------------------------------------*/
@@ -284,4 +517,22 @@ TYPED_TEST(ZipfDistributionFixture, ApproxZipfDistributionApproximateOriginalOne
   TestFixture::VerifyApproxZipf();
 }
 
+/*------------------------------------------------------------------------------
+ * Alias Zipf distribution tests
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(ZipfDistributionFixture, AliasZipfDistributionGenerateCorrectSkewValues)
+{
+  TestFixture::VerifyAliasZipf();
+}
+
+/*------------------------------------------------------------------------------
+ * Batch API tests
+ *----------------------------------------------------------------------------*/
+
+TYPED_TEST(ZipfDistributionFixture, FillGenerateCorrectSkewValues)
+{
+  TestFixture::VerifyFill();
+}
+
 }  // namespace dbgroup::random::test
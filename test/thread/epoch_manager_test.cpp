@@ -206,4 +206,150 @@ TEST_F(EpochManagerFixture, EpochGuardProtectProtectedEpochLists)
   }
 }
 
+TEST_F(EpochManagerFixture, ForwardGlobalEpochWithMultiThreadsIncrementEpochEachTime)
+{
+  constexpr size_t kLoopNum = 1000;
+  constexpr size_t kForwarderNum = 4;
+  constexpr size_t kRepeatNum = 4;
+
+  // a flag for controling worker threads
+  std::atomic_bool is_running{true};
+
+  // create entered epochs
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kRepeatNum; ++i) {
+    threads.emplace_back([&]() {
+      while (is_running) {
+        const auto &[ep_guard, protected_epochs] = epoch_manager_->GetProtectedEpochs();
+        for (size_t i = 0; i < protected_epochs.size() - 1; ++i) {
+          EXPECT_GT(protected_epochs.at(i), protected_epochs.at(i + 1));
+        }
+      }
+    });
+  }
+
+  // forward global epoch with multiple threads
+  std::vector<std::thread> forwarders;
+  for (size_t i = 0; i < kForwarderNum; ++i) {
+    forwarders.emplace_back([&]() {
+      for (size_t i = 0; i < kLoopNum; ++i) {
+        epoch_manager_->ForwardGlobalEpoch();
+      }
+    });
+  }
+  for (auto &&t : forwarders) {
+    t.join();
+  }
+  is_running = false;
+  for (auto &&t : threads) {
+    t.join();
+  }
+
+  EXPECT_EQ(epoch_manager_->GetCurrentEpoch(),
+            EpochManager::kInitialEpoch + kLoopNum * kForwarderNum);
+}
+
+TEST_F(EpochManagerFixture, TryForwardGlobalEpochWithoutContentionIncrementEpoch)
+{
+  EXPECT_TRUE(epoch_manager_->TryForwardGlobalEpoch());
+
+  EXPECT_EQ(EpochManager::kInitialEpoch + 1, epoch_manager_->GetCurrentEpoch());
+}
+
+TEST_F(EpochManagerFixture, CreateEpochSessionProtectEpochUntilRefresh)
+{
+  auto &&session = epoch_manager_->CreateEpochSession();
+  epoch_manager_->ForwardGlobalEpoch();
+  epoch_manager_->ForwardGlobalEpoch();
+  EXPECT_EQ(epoch_manager_->GetMinEpoch(), EpochManager::kInitialEpoch);
+
+  session.Refresh();
+  epoch_manager_->ForwardGlobalEpoch();
+  EXPECT_EQ(epoch_manager_->GetMinEpoch(), EpochManager::kInitialEpoch + 2);
+}
+
+TEST_F(EpochManagerFixture, EpochGuardInSessionKeepSessionEpochProtected)
+{
+  auto &&session = epoch_manager_->CreateEpochSession();
+  epoch_manager_->ForwardGlobalEpoch();
+  {
+    [[maybe_unused]] const auto &guard = epoch_manager_->CreateEpochGuard();
+  }
+
+  epoch_manager_->ForwardGlobalEpoch();
+  EXPECT_EQ(session.GetProtectedEpoch(), EpochManager::kInitialEpoch);
+  EXPECT_EQ(epoch_manager_->GetMinEpoch(), EpochManager::kInitialEpoch);
+}
+
+TEST_F(EpochManagerFixture, GetStatsWithoutGuardsGetNoOldestThread)
+{
+  epoch_manager_->ForwardGlobalEpoch();
+  epoch_manager_->ForwardGlobalEpoch();
+
+  const auto &stats = epoch_manager_->GetStats();
+  EXPECT_EQ(stats.lag, 1);
+  EXPECT_EQ(stats.oldest_thread_id, EpochManager::kNoThread);
+  EXPECT_EQ(stats.hold_time.count(), 0);
+  EXPECT_GT(stats.protected_num, 0);
+}
+
+TEST_F(EpochManagerFixture, GetStatsWithLongGuardGetOldestThread)
+{
+  constexpr size_t kLoopNum = 10;
+
+  [[maybe_unused]] const auto &guard = epoch_manager_->CreateEpochGuard();
+  for (size_t i = 0; i < kLoopNum; ++i) {
+    std::this_thread::sleep_for(std::chrono::microseconds{100});
+    epoch_manager_->ForwardGlobalEpoch();
+  }
+
+  const auto &stats = epoch_manager_->GetStats();
+  EXPECT_EQ(stats.lag, kLoopNum);
+  EXPECT_EQ(stats.oldest_thread_id, IDManager::GetThreadID());
+  EXPECT_GT(stats.hold_time, std::chrono::microseconds{100});
+  EXPECT_GT(stats.tick_duration.count(), 0);
+}
+
+TEST_F(EpochManagerFixture, SetLagCallbackWithStalledEpochCallFunction)
+{
+  constexpr size_t kThreshold = 10;
+  constexpr size_t kLoopNum = 20;
+
+  size_t call_num = 0;
+  epoch_manager_->SetLagCallback(kThreshold, [&](const EpochManager::Stats &stats) {
+    EXPECT_GE(stats.lag, kThreshold);
+    EXPECT_EQ(stats.oldest_thread_id, IDManager::GetThreadID());
+    ++call_num;
+  });
+
+  {
+    [[maybe_unused]] const auto &guard = epoch_manager_->CreateEpochGuard();
+    for (size_t i = 0; i < kLoopNum; ++i) {
+      epoch_manager_->ForwardGlobalEpoch();
+    }
+  }
+  EXPECT_EQ(call_num, kLoopNum - kThreshold + 1);
+
+  epoch_manager_->ForwardGlobalEpoch();
+  EXPECT_EQ(call_num, kLoopNum - kThreshold + 1);
+}
+
+TEST_F(EpochManagerFixture, SetLagCallbackWithForwardingFunctionAdvanceEpoch)
+{
+  constexpr size_t kThreshold = 1;
+
+  size_t call_num = 0;
+  epoch_manager_->SetLagCallback(kThreshold, [&](const EpochManager::Stats &) {
+    if (call_num++ > 0) return;
+    epoch_manager_->ForwardGlobalEpoch();  // the tick must have been finished
+  });
+
+  {
+    [[maybe_unused]] const auto &guard = epoch_manager_->CreateEpochGuard();
+    epoch_manager_->ForwardGlobalEpoch();
+  }
+  EXPECT_EQ(call_num, 2);
+  EXPECT_EQ(epoch_manager_->GetCurrentEpoch(), EpochManager::kInitialEpoch + 2);
+}
+
 }  // namespace dbgroup::thread::test
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the correspnding header
+#include "dbgroup/thread/epoch_session.hpp"
+
+// C++ standard libraries
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+// external libraries
+#include "gtest/gtest.h"
+
+// library headers
+#include "dbgroup/thread/component/epoch.hpp"
+#include "dbgroup/thread/epoch_guard.hpp"
+
+namespace dbgroup::thread::test
+{
+class EpochSessionFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Type aliases
+   *##########################################################################*/
+
+  using Epoch = component::Epoch;
+
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr size_t kULMax = std::numeric_limits<size_t>::max();
+
+  /*############################################################################
+   * Test setup/teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    current_epoch_ = 0;
+    epoch_ = std::make_unique<Epoch>();
+    epoch_->SetGrobalEpoch(&current_epoch_);
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::atomic_size_t current_epoch_{};
+
+  std::unique_ptr<Epoch> epoch_{nullptr};
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(EpochSessionFixture, ConstructorWithCurrentEpochProtectEpoch)
+{
+  const EpochSession session{epoch_.get()};
+
+  EXPECT_EQ(0, epoch_->GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, DestructorWithCurrentEpochUnprotectEpoch)
+{
+  {
+    const EpochSession session{epoch_.get()};
+  }
+
+  EXPECT_EQ(kULMax, epoch_->GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, MoveConstructorKeepEpochProtected)
+{
+  EpochSession session{epoch_.get()};
+  [[maybe_unused]] EpochSession moved{std::move(session)};
+
+  EXPECT_EQ(0, epoch_->GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, RefreshAfterForwardingProtectCurrentEpoch)
+{
+  EpochSession session{epoch_.get()};
+  ++current_epoch_;
+  EXPECT_EQ(0, session.GetProtectedEpoch());
+
+  session.Refresh();
+  EXPECT_EQ(1, session.GetProtectedEpoch());
+  EXPECT_EQ(1, epoch_->GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, EpochGuardInSessionKeepSessionEpochProtected)
+{
+  EpochSession session{epoch_.get()};
+  ++current_epoch_;
+  {
+    const EpochGuard guard{epoch_.get()};
+    EXPECT_EQ(0, guard.GetProtectedEpoch());
+  }
+
+  EXPECT_EQ(0, session.GetProtectedEpoch());
+  EXPECT_EQ(0, epoch_->GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, RefreshWithNestedGuardKeepPreviousEpoch)
+{
+  EpochSession session{epoch_.get()};
+  ++current_epoch_;
+  {
+    const EpochGuard guard{epoch_.get()};
+    session.Refresh();
+    EXPECT_EQ(0, guard.GetProtectedEpoch());
+  }
+
+  session.Refresh();
+  EXPECT_EQ(1, session.GetProtectedEpoch());
+}
+
+TEST_F(EpochSessionFixture, IsStaleAfterForwardingDetectLaggedEpoch)
+{
+  constexpr size_t kMaxLag = 2;
+
+  EpochSession session{epoch_.get()};
+  current_epoch_ += kMaxLag;
+  EXPECT_EQ(session.GetLag(), kMaxLag);
+  EXPECT_FALSE(session.IsStale(kMaxLag));
+
+  ++current_epoch_;
+  EXPECT_TRUE(session.IsStale(kMaxLag));
+
+  session.Refresh();
+  EXPECT_EQ(session.GetLag(), 0);
+  EXPECT_FALSE(session.IsStale(kMaxLag));
+}
+
+}  // namespace dbgroup::thread::test
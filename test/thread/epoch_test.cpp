@@ -90,4 +90,18 @@ TEST_F(EpochFixture, LeaveEpochAfterEnteredUnprotectEpoch)
   EXPECT_EQ(kULMax, epoch_->GetProtectedEpoch());
 }
 
+TEST_F(EpochFixture, LeaveNestedEpochKeepOutermostEpoch)
+{
+  epoch_->EnterEpoch();
+  ++current_epoch_;
+  epoch_->EnterEpoch();
+  EXPECT_EQ(0, epoch_->GetProtectedEpoch());
+
+  epoch_->LeaveEpoch();
+  EXPECT_EQ(0, epoch_->GetProtectedEpoch());
+
+  epoch_->LeaveEpoch();
+  EXPECT_EQ(kULMax, epoch_->GetProtectedEpoch());
+}
+
 }  // namespace dbgroup::thread::component::test
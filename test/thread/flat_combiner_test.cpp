@@ -0,0 +1,133 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/thread/flat_combiner.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::thread::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kExecNumPerThread = 1E5;
+
+/*##############################################################################
+ * Fixture declaration
+ *############################################################################*/
+
+class FlatCombinerFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    combiner_ = std::make_unique<FlatCombiner<uint64_t>>(0UL);
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Utilities for verification
+   *##########################################################################*/
+
+  auto
+  FetchAddWithMultiThreads()  //
+      -> std::vector<uint64_t>
+  {
+    std::vector<std::vector<uint64_t>> results(kThreadNum);
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([this, &res = results[i]]() {
+        res.reserve(kExecNumPerThread);
+        for (size_t j = 0; j < kExecNumPerThread; ++j) {
+          res.emplace_back(combiner_->Execute([](uint64_t &seq) { return seq++; }));
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+
+    std::vector<uint64_t> ids{};
+    ids.reserve(kThreadNum * kExecNumPerThread);
+    for (auto &&res : results) {
+      // each thread must receive increasing IDs
+      EXPECT_TRUE(std::is_sorted(res.begin(), res.end()));
+      ids.insert(ids.end(), res.begin(), res.end());
+    }
+    return ids;
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::unique_ptr<FlatCombiner<uint64_t>> combiner_{};
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(FlatCombinerFixture, ExecuteReturnResultOfOperation)
+{
+  EXPECT_EQ(combiner_->Execute([](uint64_t &seq) { return seq++; }), 0);
+  EXPECT_EQ(combiner_->Execute([](uint64_t &seq) { return seq++; }), 1);
+}
+
+TEST_F(FlatCombinerFixture, ExecuteVoidOperationModifyObject)
+{
+  constexpr uint64_t kVal = 7;
+  combiner_->Execute([](uint64_t &seq) { seq += kVal; });
+
+  EXPECT_EQ(combiner_->Execute([](const uint64_t &seq) { return seq; }), kVal);
+}
+
+TEST_F(FlatCombinerFixture, ExecuteWithMultiThreadsGetUniqueIDs)
+{
+  auto &&ids = FetchAddWithMultiThreads();
+  std::sort(ids.begin(), ids.end());
+
+  ASSERT_EQ(ids.size(), kThreadNum * kExecNumPerThread);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    EXPECT_EQ(ids[i], i);
+  }
+}
+
+}  // namespace dbgroup::thread::test
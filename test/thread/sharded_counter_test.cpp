@@ -0,0 +1,165 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/thread/sharded_counter.hpp"
+
+// C++ standard libraries
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+
+namespace dbgroup::thread::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kAddNumPerThread = 1E5;
+
+/*##############################################################################
+ * Fixture declaration
+ *############################################################################*/
+
+template <class T>
+class ShardedCounterFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Constants
+   *##########################################################################*/
+
+  static constexpr T kBatchSize = 100;
+
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    counter_ = std::make_unique<ShardedCounter<T>>(kBatchSize);
+  }
+
+  void
+  TearDown() override
+  {
+  }
+
+  /*############################################################################
+   * Utilities for verification
+   *##########################################################################*/
+
+  void
+  AddWithMultiThreads(  //
+      const T val)
+  {
+    std::vector<std::thread> threads{};
+    threads.reserve(kThreadNum);
+    for (size_t i = 0; i < kThreadNum; ++i) {
+      threads.emplace_back([&]() {
+        for (size_t j = 0; j < kAddNumPerThread; ++j) {
+          counter_->Add(val);
+        }
+      });
+    }
+    for (auto &&t : threads) {
+      t.join();
+    }
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::unique_ptr<ShardedCounter<T>> counter_{};
+};
+
+/*##############################################################################
+ * Preparation for typed testing
+ *############################################################################*/
+
+using CounterTypes = ::testing::Types<uint64_t, int64_t>;
+TYPED_TEST_SUITE(ShardedCounterFixture, CounterTypes);
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TYPED_TEST(ShardedCounterFixture, ConstructorInitializeZero)
+{
+  EXPECT_EQ(this->counter_->GetValue(), 0);
+  EXPECT_EQ(this->counter_->GetApproxValue(), 0);
+}
+
+TYPED_TEST(ShardedCounterFixture, AddWithinBatchSizeKeepThreadLocalValues)
+{
+  constexpr TypeParam kVal = TestFixture::kBatchSize - 1;
+  this->counter_->Add(kVal);
+
+  EXPECT_EQ(this->counter_->GetValue(), kVal);
+  EXPECT_EQ(this->counter_->GetApproxValue(), 0);
+}
+
+TYPED_TEST(ShardedCounterFixture, AddOverBatchSizeFlushThreadLocalValues)
+{
+  constexpr TypeParam kVal = TestFixture::kBatchSize;
+  this->counter_->Add(kVal);
+
+  EXPECT_EQ(this->counter_->GetValue(), kVal);
+  EXPECT_EQ(this->counter_->GetApproxValue(), kVal);
+}
+
+TYPED_TEST(ShardedCounterFixture, AddWithMultiThreadsGetExactValue)
+{
+  constexpr TypeParam kVal = 3;
+  this->AddWithMultiThreads(kVal);
+
+  constexpr auto kExpected = static_cast<TypeParam>(kVal * kAddNumPerThread * kThreadNum);
+  const auto approx = this->counter_->GetApproxValue();
+  EXPECT_EQ(this->counter_->GetValue(), kExpected);
+  EXPECT_LE(approx, kExpected);
+  EXPECT_GT(approx + TestFixture::kBatchSize * kThreadNum, kExpected);
+}
+
+TYPED_TEST(ShardedCounterFixture, SubAfterAddGetZero)
+{
+  constexpr TypeParam kVal = 7;
+  this->AddWithMultiThreads(kVal);
+  this->counter_->Sub(static_cast<TypeParam>(kVal * kAddNumPerThread * kThreadNum));
+
+  EXPECT_EQ(this->counter_->GetValue(), 0);
+}
+
+TEST(ShardedGaugeTest, SubWithoutAddGetNegativeValue)
+{
+  ShardedGauge gauge{};
+  gauge.Sub(ShardedGauge::kDefaultBatchSize);
+  gauge.Sub(1);
+
+  EXPECT_EQ(gauge.GetValue(), -ShardedGauge::kDefaultBatchSize - 1);
+  EXPECT_EQ(gauge.GetApproxValue(), -ShardedGauge::kDefaultBatchSize);
+}
+
+}  // namespace dbgroup::thread::test
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2024 Database Group, Nagoya University
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// the corresponding header
+#include "dbgroup/thread/slab_allocator.hpp"
+
+// C++ standard libraries
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// external sources
+#include "gtest/gtest.h"
+
+// local sources
+#include "common.hpp"
+#include "dbgroup/thread/epoch_manager.hpp"
+
+namespace dbgroup::thread::test
+{
+/*##############################################################################
+ * Global constants
+ *############################################################################*/
+
+constexpr size_t kBlockSize = 64;
+constexpr size_t kLargeBlockSize = SlabAllocator::kMaxBlockSize + 1;
+constexpr size_t kBlockNum = SlabAllocator::kCacheCapacity * 4;
+constexpr size_t kLoopNum = 1E3;
+
+/*##############################################################################
+ * Fixture declaration
+ *############################################################################*/
+
+class SlabAllocatorFixture : public ::testing::Test
+{
+ protected:
+  /*############################################################################
+   * Setup/Teardown
+   *##########################################################################*/
+
+  void
+  SetUp() override
+  {
+    epoch_manager_ = std::make_unique<EpochManager>();
+    allocator_ = std::make_unique<SlabAllocator>(epoch_manager_.get());
+  }
+
+  void
+  TearDown() override
+  {
+    allocator_.reset();
+    epoch_manager_.reset();
+  }
+
+  /*############################################################################
+   * Internal member variables
+   *##########################################################################*/
+
+  std::unique_ptr<EpochManager> epoch_manager_{};
+
+  std::unique_ptr<SlabAllocator> allocator_{};
+};
+
+/*##############################################################################
+ * Unit test definitions
+ *############################################################################*/
+
+TEST_F(SlabAllocatorFixture, AllocateReturnAlignedDistinctBlocks)
+{
+  std::vector<void *> blocks{};
+  for (size_t i = 0; i < kBlockNum; ++i) {
+    auto *ptr = allocator_->Allocate(kBlockSize);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % kBlockSize, 0);
+    blocks.emplace_back(ptr);
+  }
+
+  std::sort(blocks.begin(), blocks.end());
+  EXPECT_EQ(std::adjacent_find(blocks.begin(), blocks.end()), blocks.end());
+  for (auto *ptr : blocks) {
+    allocator_->Deallocate(ptr, kBlockSize);
+  }
+}
+
+TEST_F(SlabAllocatorFixture, AllocateAfterDeallocateReuseBlock)
+{
+  auto *ptr = allocator_->Allocate(kBlockSize);
+  allocator_->Deallocate(ptr, kBlockSize);
+
+  EXPECT_EQ(allocator_->Allocate(kBlockSize), ptr);
+}
+
+TEST_F(SlabAllocatorFixture, AllocateAfterRetireReuseBlockOnlyAfterEpochsPass)
+{
+  auto *ptr = allocator_->Allocate(kBlockSize);
+  allocator_->Retire(ptr, kBlockSize);
+
+  {  // a protected epoch prevents the block from being reused
+    [[maybe_unused]] const auto &guard = epoch_manager_->CreateEpochGuard();
+    epoch_manager_->ForwardGlobalEpoch();
+    epoch_manager_->ForwardGlobalEpoch();
+    allocator_->Retire(allocator_->Allocate(kBlockSize), kBlockSize);  // try reclaiming
+    auto *other = allocator_->Allocate(kBlockSize);
+    EXPECT_NE(other, ptr);
+    allocator_->Deallocate(other, kBlockSize);
+  }
+
+  epoch_manager_->ForwardGlobalEpoch();
+  epoch_manager_->ForwardGlobalEpoch();
+  allocator_->Retire(allocator_->Allocate(kBlockSize), kBlockSize);  // try reclaiming
+  auto *first = allocator_->Allocate(kBlockSize);
+  auto *second = allocator_->Allocate(kBlockSize);
+  EXPECT_TRUE(first == ptr || second == ptr);
+
+  allocator_->Deallocate(first, kBlockSize);
+  allocator_->Deallocate(second, kBlockSize);
+}
+
+TEST_F(SlabAllocatorFixture, RetireLargeBlocksReleaseThemAfterEpochsPass)
+{
+  for (size_t i = 0; i < kLoopNum; ++i) {
+    allocator_->Retire(allocator_->Allocate(kLargeBlockSize), kLargeBlockSize);
+    epoch_manager_->ForwardGlobalEpoch();
+  }
+}
+
+TEST_F(SlabAllocatorFixture, AllocateWithMultiThreadsDoNotShareBlocks)
+{
+  std::vector<std::thread> threads{};
+  threads.reserve(kThreadNum);
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&, i]() {
+      std::vector<size_t *> blocks{};
+      blocks.reserve(kBlockNum);
+      for (size_t loop = 0; loop < kLoopNum / 10; ++loop) {
+        for (size_t j = 0; j < kBlockNum; ++j) {
+          auto *ptr = static_cast<size_t *>(allocator_->Allocate(kBlockSize));
+          *ptr = i;
+          blocks.emplace_back(ptr);
+        }
+        for (auto *ptr : blocks) {
+          EXPECT_EQ(*ptr, i);
+          allocator_->Deallocate(ptr, kBlockSize);
+        }
+        blocks.clear();
+      }
+    });
+  }
+  for (auto &&t : threads) {
+    t.join();
+  }
+}
+
+}  // namespace dbgroup::thread::test